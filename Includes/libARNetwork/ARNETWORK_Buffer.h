@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Buffer.h
+ * @brief Reference-counted buffers from a lock-free pool, sent without copy and released automatically.
+ * @date 10/18/2026
+ */
+
+#ifndef _ARNETWORK_BUFFER_H_
+#define _ARNETWORK_BUFFER_H_
+
+#include <inttypes.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+
+/**
+ * @brief pool of buffers of the same capacity, allocated once
+ * @details The buffers can be taken and released by any thread without lock.
+ */
+typedef struct ARNETWORK_BufferPool_t ARNETWORK_BufferPool_t;
+
+/**
+ * @brief reference-counted buffer of a pool
+ * @details A buffer is taken with one reference. Each reference is released with ARNETWORK_Buffer_Unref() ;
+ * the buffer goes back to its pool when its last reference is released.
+ * @see ARNETWORK_Manager_SendBuffer()
+ */
+typedef struct ARNETWORK_Buffer_t ARNETWORK_Buffer_t;
+
+/**
+ * @brief Create a new pool of buffers
+ * @warning This function allocate memory
+ * @post ARNETWORK_BufferPool_Delete() must be called to delete the pool
+ * @param[in] numberOfBuffers number of buffers of the pool
+ * @param[in] bufferCapacity size in byte of the data of each buffer
+ * @param[out] error pointer on the error output ; can be equal to NULL
+ * @return Pointer on the new pool, or NULL on error
+ * @see ARNETWORK_BufferPool_Delete()
+ */
+ARNETWORK_BufferPool_t* ARNETWORK_BufferPool_New (int numberOfBuffers, int bufferCapacity, eARNETWORK_ERROR *error);
+
+/**
+ * @brief Delete a pool of buffers
+ * @details The memory of the pool is freed when its last buffer taken is released, so the buffers still queued
+ * in an ARNETWORK_Manager_t stay valid.
+ * @param poolPtrAddr address of the pointer on the pool to delete ; set to NULL
+ * @see ARNETWORK_BufferPool_New()
+ */
+void ARNETWORK_BufferPool_Delete (ARNETWORK_BufferPool_t **poolPtrAddr);
+
+/**
+ * @brief Take a free buffer from the pool
+ * @param pool the pool
+ * @return a buffer holding one reference, with a size of 0 ; NULL if all the buffers of the pool are used
+ */
+ARNETWORK_Buffer_t* ARNETWORK_BufferPool_GetBuffer (ARNETWORK_BufferPool_t *pool);
+
+/**
+ * @brief Get the data of a buffer
+ * @warning the data must not be changed while the buffer is given to an ARNETWORK_Manager_t
+ * @param buffer the buffer
+ * @return pointer on the data of the buffer
+ */
+uint8_t* ARNETWORK_Buffer_GetData (ARNETWORK_Buffer_t *buffer);
+
+/**
+ * @brief Get the capacity of a buffer
+ * @param buffer the buffer
+ * @return maximum size in byte of the data of the buffer
+ */
+int ARNETWORK_Buffer_GetCapacity (ARNETWORK_Buffer_t *buffer);
+
+/**
+ * @brief Get the size of the data of a buffer
+ * @param buffer the buffer
+ * @return size in byte of the data of the buffer
+ */
+int ARNETWORK_Buffer_GetSize (ARNETWORK_Buffer_t *buffer);
+
+/**
+ * @brief Set the size of the data of a buffer
+ * @param buffer the buffer
+ * @param[in] size size in byte of the data, from 0 to the capacity of the buffer
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Buffer_SetSize (ARNETWORK_Buffer_t *buffer, int size);
+
+/**
+ * @brief Take one more reference on a buffer
+ * @param buffer the buffer
+ */
+void ARNETWORK_Buffer_Ref (ARNETWORK_Buffer_t *buffer);
+
+/**
+ * @brief Release one reference on a buffer
+ * @details The buffer goes back to its pool when its last reference is released.
+ * @param buffer the buffer
+ */
+void ARNETWORK_Buffer_Unref (ARNETWORK_Buffer_t *buffer);
+
+#endif /* _ARNETWORK_BUFFER_H_ */
@@ -53,6 +53,7 @@ typedef enum
     ARNETWORK_ERROR_SEMAPHORE, /**< Error when using a semaphore */
     ARNETWORK_ERROR_MUTEX, /**< Error when using a mutex */
     ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK, /**< A mutex is already locked by the same thread */
+    ARNETWORK_ERROR_BUFFER_FULL, /**< Buffer is full and its oldest data can not be overwritten */
     ARNETWORK_ERROR_MANAGER = -2000, /**< Unknown ARNETWORK_Manager error */
     ARNETWORK_ERROR_MANAGER_NEW_IOBUFFER, /**< IOBuffer creation error */
     ARNETWORK_ERROR_MANAGER_NEW_SENDER, /**< Sender creation error */
@@ -61,6 +62,8 @@ typedef enum
     ARNETWORK_ERROR_NEW_RINGBUFFER, /**< RingBuffer creation error */
     ARNETWORK_ERROR_IOBUFFER = -3000, /**< Unknown IOBuffer error */
     ARNETWORK_ERROR_IOBUFFER_BAD_ACK,  /**< Bad sequence number for the acknowledge */
+    ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND, /**< The data is not in the IOBuffer anymore */
+    ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED, /**< A data of the IOBuffer is borrowed and not released yet */
     ARNETWORK_ERROR_RECEIVER = -5000, /**< Unknown Receiver error */
     ARNETWORK_ERROR_RECEIVER_BUFFER_END, /**< Receiver buffer too small */
     ARNETWORK_ERROR_RECEIVER_BAD_FRAME, /**< Bad frame content on network */
@@ -57,12 +57,55 @@
  */
 #define ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX -1
 
+/**
+ * @brief Maximum number of leading data bytes usable as coalescing key.
+ * @note This matches the size of the ARCommands header (project, class and command).
+ */
+#define ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX 4
+
+/**
+ * @brief Maximum number of sender lanes.
+ */
+#define ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX 4
+
+/**
+ * @brief Maximum number of receiver shards.
+ */
+#define ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX 4
+
+/**
+ * @brief Maximum number of subscribers of an output buffer.
+ */
+#define ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX 16
+
 /*****************************************
  *
  *             IOBufferParam header:
  *
  *****************************************/
 
+/**
+ * @brief unit of the rate limit of an input buffer
+ */
+typedef enum
+{
+    ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_BYTES = 0, /**< rate limit in bytes, counting the size of the frames given to ARNetworkAL */
+    ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_FRAMES, /**< rate limit in frames */
+    ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_MAX /**< unused, iterator maximum value */
+
+} eARNETWORK_IOBUFFERPARAM_RATELIMITUNIT;
+
+/**
+ * @brief behavior of an input buffer when the ARNetworkAL buffer is full
+ */
+typedef enum
+{
+    ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_DROP = 0, /**< the data that does not fit is discarded (data and low latency data buffers only ; the data with acknowledgement are always kept) */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_KEEP, /**< the data that does not fit is kept in the buffer and sent in a next pass of the sender, after a wait adapted to the ARNetworkAL drain rate */
+    ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_MAX /**< unused, iterator maximum value */
+
+} eARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY;
+
 /**
  * @brief used to set the parameters of a new In Out Buffer
  */
@@ -78,6 +121,40 @@ typedef struct
     int32_t dataCopyMaxSize; /**< Maximum Size, in byte, of the data copied in the buffer (the IOBuffer allocates a buffer of numberOfCell X dataCopyMaxSize ).
                                A value of ARNETWORK_IOBUFFERPARAM_DATACOPYMAXSIZE_USE_MAX automatically allocates the maximum size allowed by the underlying media. */
     int isOverwriting; /**< Indicator of overwriting possibility (1 = true | 0 = false)*/
+    int coalescingKeySize; /**< Number of leading bytes of the data used as coalescing key (0 = coalescing disabled | 1 to ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX).
+                             When enabled, a new data replaces the data already queued with the same key instead of being added at the end of the buffer.
+                             Only available on input buffers. */
+    int rateLimit; /**< Maximum sending rate, in rateLimitUnit per second, enforced by a token bucket when the IOBuffer is used with a ARNetwork_Sender (0 = no limit) */
+    int rateLimitBurst; /**< Size, in rateLimitUnit, of the token bucket: maximum amount of data sent in a burst without waiting the rate limit.
+                          A frame larger than the bucket is sent when the bucket is full. */
+    eARNETWORK_IOBUFFERPARAM_RATELIMITUNIT rateLimitUnit; /**< Unit of rateLimit and rateLimitBurst */
+    int sendBurstSize; /**< Maximum number of data sent in one pass of the ARNetwork_Sender, before waiting sendingWaitTimeMs (0 = default, one data ; ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER = send until the ARNetworkAL buffer is full).
+                         Ignored by the buffers of data with acknowledgement, which send one data at a time. */
+    eARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY overflowPolicy; /**< Behavior of the input buffer when its data does not fit in the ARNetworkAL buffer */
+    int alHeadroomSize; /**< Size, in byte, of the ARNetworkAL buffer left free by this input buffer in each pass of the sender, for the acknowledgements and the low latency data (0 = use the whole ARNetworkAL buffer).
+                          A data that would use this headroom is handled as an overflow, according to overflowPolicy. */
+    int isSendingInline; /**< Indicator of sending from the calling thread (1 = true | 0 = false). Only available on ARNETWORKAL_FRAME_TYPE_DATA and ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY input buffers.
+                           When the buffer is empty and ARNetworkAL is not used by the sending thread, ARNETWORK_Manager_SendData() and ARNETWORK_Manager_SendBuffer() give the data to ARNetworkAL,
+                           which makes the only copy of the data, without copying it in the buffer. A low latency data is sent immediately, without waiting sendingWaitTimeMs ;
+                           a data is sent when sendingWaitTimeMs is elapsed since the previous data of the buffer, and can be held by the send coalescing window.
+                           Otherwise the data is added in the buffer and sent by the sending thread. */
+    int senderLane; /**< Sender lane processing the input buffer (0 = ARNETWORK_Manager_SendingThreadRun() | 1 to ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX - 1 = thread calling ARNETWORK_Manager_SendingLaneThreadRun()).
+                      Only available on input buffers. */
+    int isLockFree; /**< Indicator of adding the data without lock (1 = true | 0 = false). Only available on input buffers, with isOverwriting, coalescingKeySize and isSendingInline equal to 0.
+                      ARNETWORK_Manager_SendData() and ARNETWORK_Manager_SendDataWithTimeout() then add the data in a queue lock-free for several producers,
+                      instead of taking the mutex of the buffer, so the threads adding data in the buffer do not wait each other nor the sender. */
+    int receiverShard; /**< Receiver shard processing the data received by the output buffer (0 = ARNETWORK_Manager_ReceivingThreadRun() | 1 to ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX - 1 = thread calling ARNETWORK_Manager_ReceivingShardThreadRun()).
+                         Only available on output buffers. */
+    int isFlowControlled; /**< Indicator of flow control (1 = true | 0 = false). Only available on ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers with isOverwriting equal to 0, and must be set on the buffers of both devices.
+                            The output buffer then advertises its number of free cells on the acknowledgements it returns, and the input buffer stops sending, for at most ackTimeoutMs,
+                            while the output buffer is full, instead of retrying data the remote device cannot store. */
+    int isLatestOnly; /**< Indicator of keeping only the latest data received (1 = true | 0 = false). Only available on output buffers.
+                        The data received replaces the previous one in a single slot, read with ARNETWORK_Manager_ReadLatest() without taking the mutex of the buffer,
+                        so the readers never block the receiving thread. The other read functions find the buffer empty. */
+    int maxNumberOfSubscribers; /**< Maximum number of subscribers reading the output buffer at the same time (0 = no subscriber | 1 to ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX).
+                                  Only available on output buffers with isLatestOnly equal to 0. Each data received is then read by every subscriber, with its own read position,
+                                  through ARNETWORK_Manager_ReadSubscribedData(). The receiving thread never waits for a slow subscriber: the data it did not read in time are overwritten and reported as lost.
+                                  The other read functions find the buffer empty. */
 
 }ARNETWORK_IOBufferParam_t;
 
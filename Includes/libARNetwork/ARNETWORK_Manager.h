@@ -38,7 +38,10 @@
 #ifndef _ARNETWORK_MANAGER_H_
 #define _ARNETWORK_MANAGER_H_
 
+#include <time.h>
+#include <sys/uio.h>
 #include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Buffer.h>
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
 
@@ -79,6 +82,60 @@ typedef enum
  */
 typedef eARNETWORK_MANAGER_CALLBACK_RETURN (*ARNETWORK_Manager_Callback_t) (int IoBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
 
+/**
+ * @brief callback used to update a periodic data before each of its sendings
+ * @warning the callback can't call the ARNETWORK's functions
+ * @param[in] IoBufferId identifier of the IoBuffer sending the periodic data
+ * @param[in,out] dataPtr pointer on the periodic data, to update in place
+ * @param[in,out] dataSizePtr pointer on the size of the periodic data, can be changed up to dataCapacity
+ * @param[in] dataCapacity maximum size of the periodic data
+ * @param[in] customData custom data
+ * @see ARNETWORK_Manager_StartPeriodicData()
+ */
+typedef void (*ARNETWORK_Manager_PeriodicDataUpdate_t) (int IoBufferId, uint8_t *dataPtr, int *dataSizePtr, int dataCapacity, void *customData);
+
+/**
+ * @brief handler of the data received by an output buffer, called by the receiving thread (or the thread of the receiver shard of the output buffer) instead of storing the data
+ * @warning the handler is called with the output buffer locked: it can't call the ARNETWORK's functions on its own output buffer, and should return quickly as it delays the reception of all the data
+ * @param[in] IoBufferId identifier of the output buffer
+ * @param[in] dataPtr pointer on the data received, in the reception buffer of ARNetworkAL (or in the queue of the receiver shard) ; valid only during the call
+ * @param[in] dataSize size of the data received
+ * @param[in] customData custom data
+ * @see ARNETWORK_Manager_SetOutputBufferHandler()
+ */
+typedef void (*ARNETWORK_Manager_OutputHandler_t) (int IoBufferId, const uint8_t *dataPtr, int dataSize, void *customData);
+
+/**
+ * @brief handle of a data to send, used to cancel or replace it while it is queued
+ * @see ARNETWORK_Manager_SendDataWithHandle()
+ */
+typedef uint32_t ARNETWORK_Manager_DataHandle_t;
+
+#define ARNETWORK_MANAGER_DATA_HANDLE_INVALID (0) /**< handle never given to a data */
+
+#define ARNETWORK_MANAGER_WAITANY_MAX (32) /**< maximum number of output buffers waited by ARNETWORK_Manager_WaitAny() */
+
+/**
+ * @brief data to send, entry of the array given to ARNETWORK_Manager_SendDataBatch()
+ */
+typedef struct
+{
+    int inputBufferID; /**< identifier of the input buffer in which the data must be stored */
+    uint8_t *dataPtr; /**< pointer on the data to send */
+    int dataSize; /**< size of the data to send */
+    void *customData; /**< custom data sent to the callback */
+    eARNETWORK_ERROR error; /**< set by ARNETWORK_Manager_SendDataBatch() to the result of the adding of the data */
+} ARNETWORK_Manager_BatchData_t;
+
+/**
+ * @brief data read, entry of the array filled by ARNETWORK_Manager_ReadDataBatch()
+ */
+typedef struct
+{
+    uint8_t *dataPtr; /**< pointer on the data read, in the buffer given to ARNETWORK_Manager_ReadDataBatch() */
+    int dataSize; /**< size of the data read */
+} ARNETWORK_Manager_ReadSlice_t;
+
 /**
  * @brief network manager allow to send and receive data acknowledged or not.
  */
@@ -130,6 +187,28 @@ void ARNETWORK_Manager_Delete(ARNETWORK_Manager_t **managerPtrAddr);
  */
 void* ARNETWORK_Manager_SendingThreadRun(void *data);
 
+/**
+ * @brief Gets the thread data of a sender lane
+ * @details The input buffers created with a senderLane greater than 0 are processed by the thread of their lane, instead of the thread calling ARNETWORK_Manager_SendingThreadRun().
+ * Each lane used by an input buffer must be run by its own thread, calling ARNETWORK_Manager_SendingLaneThreadRun() with the pointer returned by this function.
+ * @param managerPtr pointer on the Manager
+ * @param[in] laneIndex index of the lane, from 1 to ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX - 1
+ * @return thread data of the lane, or NULL if no input buffer uses this lane
+ * @see ARNETWORK_Manager_SendingLaneThreadRun()
+ */
+void* ARNETWORK_Manager_GetSendingLane(ARNETWORK_Manager_t *managerPtr, int laneIndex);
+
+/**
+ * @brief Manage the sending of the data of the input buffers assigned to a sender lane
+ * @warning This function must be called in its own thread.
+ * @post Before join the thread calling this function, ARNETWORK_Manager_Stop() must be called.
+ * @param data thread data returned by ARNETWORK_Manager_GetSendingLane()
+ * @return NULL
+ * @see ARNETWORK_Manager_GetSendingLane()
+ * @see ARNETWORK_Manager_Stop()
+ */
+void* ARNETWORK_Manager_SendingLaneThreadRun(void *data);
+
 /**
  * @brief Manage the reception of the data.
  * @warning This function must be called by a specific thread.
@@ -140,9 +219,33 @@ void* ARNETWORK_Manager_SendingThreadRun(void *data);
  */
 void* ARNETWORK_Manager_ReceivingThreadRun(void *data);
 
+/**
+ * @brief Gets the thread data of a receiver shard
+ * @details The data received by the output buffers created with a receiverShard greater than 0 are copied by the thread calling ARNETWORK_Manager_ReceivingThreadRun()
+ * in the queue of their shard, then stored in the output buffers, and acknowledged, by the thread of their shard.
+ * The acknowledgements, the pings and the output buffers of the shard 0 stay processed by the thread calling ARNETWORK_Manager_ReceivingThreadRun().
+ * Each shard used by an output buffer must be run by its own thread, calling ARNETWORK_Manager_ReceivingShardThreadRun() with the pointer returned by this function.
+ * @param managerPtr pointer on the Manager
+ * @param[in] shardIndex index of the shard, from 1 to ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX - 1
+ * @return thread data of the shard, or NULL if no output buffer uses this shard
+ * @see ARNETWORK_Manager_ReceivingShardThreadRun()
+ */
+void* ARNETWORK_Manager_GetReceivingShard(ARNETWORK_Manager_t *managerPtr, int shardIndex);
+
+/**
+ * @brief Manage the data received by the output buffers assigned to a receiver shard
+ * @warning This function must be called in its own thread.
+ * @post Before join the thread calling this function, ARNETWORK_Manager_Stop() must be called.
+ * @param data thread data returned by ARNETWORK_Manager_GetReceivingShard()
+ * @return NULL
+ * @see ARNETWORK_Manager_GetReceivingShard()
+ * @see ARNETWORK_Manager_Stop()
+ */
+void* ARNETWORK_Manager_ReceivingShardThreadRun(void *data);
+
 /**
  * @brief stop the threads of sending and reception
- * @details Used to kill the threads calling ARNETWORK_Manager_SendingThreadRun() and ARNETWORK_Manager_ReceivingThreadRun().
+ * @details Used to kill the threads calling ARNETWORK_Manager_SendingThreadRun(), ARNETWORK_Manager_SendingLaneThreadRun(), ARNETWORK_Manager_ReceivingThreadRun() and ARNETWORK_Manager_ReceivingShardThreadRun().
  * @param managerPtr pointer on the Manager
  * @see ARNETWORK_Manager_SendingThreadRun()
  * @see ARNETWORK_Manager_ReceivingThreadRun()
@@ -169,6 +272,200 @@ eARNETWORK_ERROR ARNETWORK_Manager_Flush(ARNETWORK_Manager_t *managerPtr);
  */
 eARNETWORK_ERROR ARNETWORK_Manager_SendData(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
 
+/**
+ * @brief Add data to send in a IOBuffer, waiting with timeout for a free cell if the IOBuffer is full
+ * @details The calling thread sleeps until the sender frees a cell of the input buffer (data sent, acknowledged or canceled),
+ * so a producer faster than the network is slowed down instead of losing its data.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @param[in] timeoutMs maximum time in millisecond to wait if the input buffer is full
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the input buffer is still full after timeoutMs
+ * @see ARNETWORK_Manager_SendData()
+ * @see ARNETWORK_Manager_GetInputBufferWritableEventFd()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithTimeout(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs);
+
+/**
+ * @brief Add data made of several segments to send in a IOBuffer
+ * @details The segments (for example a header and a payload) are gathered directly in the data copy of the input buffer,
+ * so the application does not need to assemble them first. The data is always copied: the total size of the segments
+ * must not be more than the dataCopyMaxSize of the input buffer. The segments can be reused as soon as the function returns.
+ * The data pointer given to the callback is the data copy.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] segmentArr array of the segments of the data to send
+ * @param[in] numberOfSegments number of segments in segmentArr
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataV(ARNETWORK_Manager_t *managerPtr, int inputBufferID, const struct iovec *segmentArr, int numberOfSegments, void *customData, ARNETWORK_Manager_Callback_t callback);
+
+/**
+ * @brief Add the data of a reference-counted buffer to send in a IOBuffer, without copy
+ * @details The input buffer takes its own reference on the buffer, and releases it once the data is sent, acknowledged or canceled,
+ * after the callback with the ARNETWORK_MANAGER_CALLBACK_STATUS_DONE status. The caller keeps its reference:
+ * the same buffer can be given to several input buffers or managers, then released by the caller with ARNETWORK_Buffer_Unref().
+ * An input buffer sending inline sends the data during the call when it can, without taking a reference.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] buffer buffer holding the data to send ; its size is the size of the data
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred ; can be equal to NULL
+ * @return error eARNETWORK_ERROR ; on error the input buffer does not keep any reference on the buffer
+ * @see ARNETWORK_BufferPool_GetBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendBuffer(ARNETWORK_Manager_t *managerPtr, int inputBufferID, ARNETWORK_Buffer_t *buffer, void *customData, ARNETWORK_Manager_Callback_t callback);
+
+/**
+ * @brief Add data to send in a coalescing IOBuffer, with an explicit coalescing key
+ * @details If a data with the same key is still waiting to be sent, it is replaced in place by the new data
+ * and its callback is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status.
+ * A data being sent and waiting for its acknowledgement is never replaced.
+ * @note ARNETWORK_Manager_SendData() uses the first coalescingKeySize bytes of the data as key.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored ; the buffer must be created with a coalescingKeySize different of 0
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] key coalescing key of the data
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_IOBufferParam_t
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithKey(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, uint32_t key, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Add data to send in a IOBuffer at a given date
+ * @details The data is held by the sender until sendTime, then sent within some microseconds: the sender lane sleeps the last fraction of millisecond before sendTime,
+ * without the minimum time between sends, when sendTime is its next event
+ * (the data is never sent before sendTime, a date already reached sends it as soon as possible).
+ * The data keeps its place in the input buffer: the data added after it in the same input buffer wait its sending,
+ * the data added before it must be sent first.
+ * The callback is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_SENT status when the data is actually sent.
+ * @note sendTime is a date of the monotonic clock used by ARSAL_Time_GetTime().
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] sendTime date before which the data is not sent
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataAt(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, const struct timespec *sendTime, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Add data to send in a IOBuffer and get its handle
+ * @details The handle allows to cancel the data with ARNETWORK_Manager_CancelData(),
+ * or to replace its content with ARNETWORK_Manager_ReplaceData(), as long as the data is in the input buffer:
+ * before its sending, or while it waits its acknowledgement.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @param[out] handlePtr pointer on the handle of the data
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithHandle(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, ARNETWORK_Manager_DataHandle_t *handlePtr);
+
+/**
+ * @brief Add several data to send, in one or several IOBuffers
+ * @details The batch is checked once, then the data of each input buffer are added under one lock of the input buffer,
+ * in their order in the batch, and the sender is woken up once at the end.
+ * The data are never sent from the calling thread, even by an input buffer with isSendingInline set.
+ * The callback is called only for the data added: the error field of each entry tells if its data is added.
+ * @param managerPtr pointer on the Manager
+ * @param[in,out] batchArr array of the data to send ; the error field of each entry is set
+ * @param[in] batchSize number of entries of batchArr
+ * @param[in] callback pointer on the callback to call when a data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BAD_PARAMETER or ARNETWORK_ERROR_ID_UNKNOWN if an entry is not valid, in which case no data is added,
+ * otherwise the first error of the entries (ARNETWORK_OK if all the data are added)
+ * @see ARNETWORK_Manager_SendData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataBatch(ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_BatchData_t *batchArr, int batchSize, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Cancel a data still in its input buffer
+ * @details The callback of the data is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status, then the data is freed.
+ * A data waiting its acknowledgement is not sent again.
+ * @param managerPtr pointer on the Manager
+ * @param[in] handle handle of the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND if the data is already sent, acknowledged or canceled
+ * @see ARNETWORK_Manager_SendDataWithHandle()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_CancelData(ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_DataHandle_t handle);
+
+/**
+ * @brief Replace in place the content of a data still in its input buffer
+ * @details The data keeps its place and its callback. A data copied in the Manager gets a copy of the new content ;
+ * otherwise the Manager keeps the new pointer, and the previous one is given back with the ARNETWORK_MANAGER_CALLBACK_STATUS_FREE status.
+ * A data waiting its acknowledgement is sent again as a new data.
+ * @note The coalescing key of the data is not changed.
+ * @param managerPtr pointer on the Manager
+ * @param[in] handle handle of the data
+ * @param[in] dataPtr pointer on the new content of the data
+ * @param[in] dataSize size of the new content of the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND if the data is already sent, acknowledged or canceled
+ * @see ARNETWORK_Manager_SendDataWithHandle()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReplaceData(ARNETWORK_Manager_t *managerPtr, ARNETWORK_Manager_DataHandle_t handle, uint8_t *dataPtr, int dataSize);
+
+/**
+ * @brief Start to send a data periodically in an input buffer
+ * @details The data is copied in a slot of the input buffer, and sent by the sender every periodMs milliseconds, starting now,
+ * without any call of ARNETWORK_Manager_SendData() and without callback with sent status.
+ * The slot can be updated with ARNETWORK_Manager_UpdatePeriodicData(), or before each sending by the updateCallback.
+ * The data added with ARNETWORK_Manager_SendData() in the same input buffer are still sent normally.
+ * The periodic data uses the token bucket of the input buffer: a sending due is delayed until the rate limit allows it.
+ * Starting a periodic data on an input buffer already sending one replaces it.
+ * @note The periodic data is not removed by the flush of the input buffer.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer ; the buffer must not be acknowledged
+ * @param[in] dataPtr pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] periodMs period of the sendings in millisecond
+ * @param[in] updateCallback callback to call before each sending to update the data ; can be equal to NULL
+ * @param[in] customData custom data sent to the updateCallback
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the data does not fit in a frame of ARNetworkAL
+ * @see ARNETWORK_Manager_StopPeriodicData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_StartPeriodicData(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize, int periodMs, ARNETWORK_Manager_PeriodicDataUpdate_t updateCallback, void *customData);
+
+/**
+ * @brief Update the periodic data of an input buffer
+ * @details The data is copied in the slot of the periodic data, and used from its next sending.
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer sending a periodic data
+ * @param[in] dataPtr pointer on the new data
+ * @param[in] dataSize size of the new data ; must not be greater than the size of the slot (the largest of the size given to ARNETWORK_Manager_StartPeriodicData() and the dataCopyMaxSize of the input buffer)
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_UpdatePeriodicData(ARNETWORK_Manager_t *managerPtr, int inputBufferID, uint8_t *dataPtr, int dataSize);
+
+/**
+ * @brief Stop to send the periodic data of an input buffer
+ * @param managerPtr pointer on the Manager
+ * @param[in] inputBufferID identifier of the input buffer
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_StartPeriodicData()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_StopPeriodicData(ARNETWORK_Manager_t *managerPtr, int inputBufferID);
+
 /**
  * @brief Read data received in a IOBuffer using variable size data (blocking function)
  * @warning This is a blocking function.
@@ -205,6 +502,127 @@ eARNETWORK_ERROR ARNETWORK_Manager_TryReadData(ARNETWORK_Manager_t *managerPtr,
  */
 eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr, int timeoutMs);
 
+/**
+ * @brief Read, with timeout, several data received in IOBuffer in one call
+ * @details The data are copied one after the other in dataPtr, and described by the slices of sliceArr, in the order they were received.
+ * The reading stops at maxNumberOfSlices data, or at the first data which does not fit in the room left in dataPtr, which stays in the output buffer.
+ * When accumulationTimeUs is not 0, the function waits, after the first data, until maxNumberOfSlices data are received or accumulationTimeUs is elapsed.
+ * @note The data are read and popped by chunks, in one lock of the output buffer. The semaphore of the output buffer can only be decremented by one: it is still taken once per data read, without waiting after the first data when accumulationTimeUs is 0.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] dataPtr buffer in which the data are copied
+ * @param[in] dataLimitSize size of dataPtr: maximum number of bytes read
+ * @param[out] sliceArr array of slices describing the data read
+ * @param[in] maxNumberOfSlices number of slices in sliceArr: maximum number of data read
+ * @param[out] numberOfSlicesPtr pointer to store the number of data read
+ * @param[in] timeoutMs maximum time in millisecond to wait for the first data (0 = do not wait)
+ * @param[in] accumulationTimeUs maximum time in microsecond to wait for more data after the first one (0 = only read the data already received)
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_SIZE if the first data does not fit in dataPtr
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatch(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, ARNETWORK_Manager_ReadSlice_t *sliceArr, int maxNumberOfSlices, int *numberOfSlicesPtr, int timeoutMs, int accumulationTimeUs);
+
+/**
+ * @brief Borrow, with timeout, a data received in IOBuffer, without copying it
+ * @details The data is parsed in place in the output buffer, then must be released with ARNETWORK_Manager_ReadDataRelease().
+ * Until then, the output buffer keeps the data: a data received while the output buffer is full is discarded (ARNETWORK_ERROR_BUFFER_FULL), even if the output buffer is overwriting,
+ * and the other read functions return ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED. Only one data of an output buffer can be borrowed at a time.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] dataPtrAddr address to store the pointer on the data, valid until the data is released
+ * @param[out] dataSizePtr pointer to store the size of the data
+ * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read (0 = do not wait)
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if a data of the output buffer is already borrowed
+ * @see ARNETWORK_Manager_ReadDataRelease()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBorrow(ARNETWORK_Manager_t *managerPtr, int outputBufferID, const uint8_t **dataPtrAddr, int *dataSizePtr, int timeoutMs);
+
+/**
+ * @brief Release a data borrowed with ARNETWORK_Manager_ReadDataBorrow(), and pop it from its output buffer
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer of the data borrowed
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BAD_PARAMETER if no data of the output buffer is borrowed
+ * @see ARNETWORK_Manager_ReadDataBorrow()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataRelease(ARNETWORK_Manager_t *managerPtr, int outputBufferID);
+
+/**
+ * @brief Read the newest data received in IOBuffer, discarding the older ones
+ * @details On an output buffer created with isLatestOnly, the data is read in the slot of the latest data, without taking the mutex of the buffer,
+ * and stays readable until a newer data is received. Otherwise the newest data is read and popped with all the older data, which are discarded at once without being read.
+ * The function does not wait: it returns ARNETWORK_ERROR_BUFFER_EMPTY if there is no data to read.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[out] dataPtr pointer on the data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSizePtr pointer to store the size of the data read
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_SIZE, without discarding any data, if the newest data does not fit in dataPtr
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadLatest(ARNETWORK_Manager_t *managerPtr, int outputBufferID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr);
+
+/**
+ * @brief Subscribe to the data received by an output buffer
+ * @details The output buffer must be created with maxNumberOfSubscribers greater than 0. The subscriber reads, with ARNETWORK_Manager_ReadSubscribedData(),
+ * every data received after its subscription, independently of the other subscribers.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[out] subscriberIDPtr pointer to store the identifier of the subscriber
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_SIZE if the output buffer already has maxNumberOfSubscribers subscribers
+ * @see ARNETWORK_Manager_UnsubscribeOutputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SubscribeOutputBuffer(ARNETWORK_Manager_t *managerPtr, int outputBufferID, int *subscriberIDPtr);
+
+/**
+ * @brief Unsubscribe from the data received by an output buffer
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[in] subscriberID identifier of the subscriber returned by ARNETWORK_Manager_SubscribeOutputBuffer()
+ * @return error eARNETWORK_ERROR type
+ * @see ARNETWORK_Manager_SubscribeOutputBuffer()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_UnsubscribeOutputBuffer(ARNETWORK_Manager_t *managerPtr, int outputBufferID, int subscriberID);
+
+/**
+ * @brief Read the next data received by an output buffer for one of its subscribers
+ * @details The receiving thread never waits for the subscribers: when a subscriber does not read a data before numberOfCell newer data are received,
+ * the data are overwritten, skipped by the subscriber and counted in numberOfDataLostPtr.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer in which the data must be read
+ * @param[in] subscriberID identifier of the subscriber returned by ARNETWORK_Manager_SubscribeOutputBuffer()
+ * @param[out] dataPtr pointer on the data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSizePtr pointer to store the size of the data read ; can be equal to NULL
+ * @param[out] numberOfDataLostPtr pointer to store the number of data lost by the subscriber since its previous reading ; can be equal to NULL
+ * @param[in] timeoutMs maximum time in millisecond to wait for a data (0 = do not wait)
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_EMPTY if no data is received before the timeout ; ARNETWORK_ERROR_BUFFER_SIZE, without reading the data, if it does not fit in dataPtr
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadSubscribedData(ARNETWORK_Manager_t *managerPtr, int outputBufferID, int subscriberID, uint8_t *dataPtr, int dataLimitSize, int *readSizePtr, int *numberOfDataLostPtr, int timeoutMs);
+
+/**
+ * @brief Set the handler of the data received by an output buffer
+ * @details While a handler is set, the data received by the output buffer are given to the handler by the thread processing the output buffer, without copy in the output buffer, instead of being stored:
+ * the read functions only get the data stored before. A data with acknowledgement is acknowledged after the return of the handler.
+ * When the function returns, the previous handler is not running and will not be called anymore.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferID identifier of the output buffer
+ * @param[in] handler handler of the data received (NULL = store the data in the output buffer)
+ * @param[in] customData custom data sent to the handler
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetOutputBufferHandler(ARNETWORK_Manager_t *managerPtr, int outputBufferID, ARNETWORK_Manager_OutputHandler_t handler, void *customData);
+
+/**
+ * @brief Wait until at least one of several output buffers has a data to read
+ * @details The data are not read: the application reads them with the read functions, with a zero timeout, for the output buffers set in the ready mask.
+ * The function is woken up once per batch of frames received, whatever the number of data added.
+ * @param managerPtr pointer on the ARNETWORK_Manager_t
+ * @param[in] outputBufferIDArr identifiers of the output buffers to wait
+ * @param[in] numberOfOutputBuffers number of identifiers in outputBufferIDArr ; from 1 to ARNETWORK_MANAGER_WAITANY_MAX
+ * @param[in] timeoutMs maximum time in millisecond to wait if there is no data to read (0 = do not wait)
+ * @param[out] readyMaskPtr pointer to store the mask of the output buffers with a data to read: bit i for outputBufferIDArr[i]
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_EMPTY if no output buffer has a data to read at the end of the timeout
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_WaitAny(ARNETWORK_Manager_t *managerPtr, const int *outputBufferIDArr, int numberOfOutputBuffers, int timeoutMs, uint32_t *readyMaskPtr);
+
 /**
  * @brief Flush an input buffer
  * @param managerPtr Pointer to the ARNETWORK_Manager_t
@@ -240,6 +658,32 @@ int ARNETWORK_Manager_GetEstimatedLatency (ARNETWORK_Manager_t *managerPtr);
  */
 int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *managerPtr, int outBufferID);
 
+/**
+ * @brief Gets the ARNetworkAL overflow counters of an input buffer
+ * @details An overflow occurs each time a data of the input buffer does not fit in the ARNetworkAL buffer (or in its part not reserved by alHeadroomSize).
+ * According to the overflowPolicy of the buffer, the data is then discarded (counted as a drop) or kept to be sent later.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param inBufferID Identifier of the input buffer
+ * @param[out] overflowCount Number of overflows of the input buffer since its creation ; can be equal to NULL
+ * @param[out] dropCount Number of data of the input buffer discarded after an overflow since its creation ; can be equal to NULL
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferOverflowStats (ARNETWORK_Manager_t *managerPtr, int inBufferID, uint32_t *overflowCount, uint32_t *dropCount);
+
+/**
+ * @brief Gets the state of the queue of an input buffer
+ * @details The estimated drain time is the time the sender needs to send all the data of the input buffer,
+ * according to its sendingWaitTimeMs, sendBurstSize and rate limit, and to the estimated latency for the data with ack.
+ * It does not take in account the network congestion.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param inBufferID Identifier of the input buffer
+ * @param[out] numberOfData Number of data waiting to be sent or acknowledged ; can be equal to NULL
+ * @param[out] numberOfFreeCells Number of data which can be added before the input buffer is full ; can be equal to NULL
+ * @param[out] drainTimeMs Estimated time, in millisecond, to send all the data of the input buffer ; can be equal to NULL
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferQueueState (ARNETWORK_Manager_t *managerPtr, int inBufferID, int *numberOfData, int *numberOfFreeCells, int *drainTimeMs);
+
 /**
  * @brief Sets the minimum time between two network sends for the given ARNETWORK_Manager_t
  * Default value is 1ms
@@ -251,6 +695,27 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *managerPt
  */
 eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager_t *managerPtr, int minimumTimeMs);
 
+/**
+ * @brief Sets the send coalescing window of the given ARNETWORK_Manager_t
+ * The frames given to ARNetworkAL are held up to this time, so that the frames of several buffers are sent in one network send.
+ * Default value is 0 (each run of the sender sends its frames)
+ * @note The frames of the @ref ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY buffers, the acknowledgements, the pings and the pongs are never held: they are sent with all the frames held
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @note The end of the window is waited to the microsecond: a window shorter than a millisecond still gathers the frames given to ARNetworkAL during it
+ * @param windowUs Maximum time, in microseconds, between the first frame given to ARNetworkAL and the network send
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_SetSendCoalescingWindow (ARNETWORK_Manager_t *managerPtr, int windowUs);
+
+/**
+ * @brief Gets the sending counters of the given ARNETWORK_Manager_t
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param[out] framesCount Number of frames given to ARNetworkAL since the creation of the manager ; can be equal to NULL
+ * @param[out] sendsCount Number of network sends of at least one frame since the creation of the manager ; can be equal to NULL
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetSenderStats (ARNETWORK_Manager_t *managerPtr, uint32_t *framesCount, uint32_t *sendsCount);
+
 /**
  * @brief Get eventfd associated to incoming data. (Linux platform only)
  * This fd shall be used to monitor incoming packets.
@@ -261,5 +726,30 @@ eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager
  */
 eARNETWORK_ERROR ARNETWORK_Manager_GetInputDataEventFd (ARNETWORK_Manager_t *managerPtr, int *fd);
 
+/**
+ * @brief Get eventfd associated to the free space of an input buffer. (Linux platform only)
+ * This fd shall be used to monitor when data can be sent without ARNETWORK_ERROR_BUFFER_SIZE.
+ * This fd is readable while the input buffer is not full. The application must not read it.
+ * @note The eventfds are only available when the library is built with ENABLE_MONITOR_INCOMING_DATA (disabled by default) ; otherwise the function returns ARNETWORK_ERROR_IOBUFFER.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param inBufferID Identifier of the input buffer
+ * @param [out] File descriptor pointer filled by function on success.
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferWritableEventFd (ARNETWORK_Manager_t *managerPtr, int inBufferID, int *fd);
+
+/**
+ * @brief Get eventfd associated to the data of an output buffer. (Linux platform only)
+ * This fd shall be used to monitor when data can be read without ARNETWORK_ERROR_BUFFER_EMPTY.
+ * This fd is readable while the output buffer is not empty (a borrowed data counts). The application must not read it.
+ * It is written only when the output buffer becomes not empty, not for each data received.
+ * @note The eventfds are only available when the library is built with ENABLE_MONITOR_INCOMING_DATA (disabled by default) ; otherwise the function returns ARNETWORK_ERROR_IOBUFFER.
+ * @param managerPtr Pointer to the ARNETWORK_Manager_t
+ * @param outBufferID Identifier of the output buffer
+ * @param [out] File descriptor pointer filled by function on success.
+ * @return error eARNETWORK_ERROR type
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetOutputBufferReadableEventFd (ARNETWORK_Manager_t *managerPtr, int outBufferID, int *fd);
+
 
 #endif /* _ARNETWORK_MANAGER_H_ */
@@ -39,6 +39,7 @@
 #define _ARNETWORK_H_
 
 #include <libARNetwork/ARNETWORK_Error.h>
+#include <libARNetwork/ARNETWORK_Buffer.h>
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARNetwork/ARNETWORK_Manager.h>
 
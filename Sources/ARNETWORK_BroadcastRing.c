@@ -0,0 +1,250 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_BroadcastRing.c
+ * @brief Ring shared by several subscribers, each reading it with its own cursor.
+ * @date 10/18/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ ******************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ARNETWORK_BroadcastRing.h"
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ ******************************************/
+
+ARNETWORK_BroadcastRing_t* ARNETWORK_BroadcastRing_New(unsigned int numberOfCell, unsigned int cellSize, int maxNumberOfSubscribers)
+{
+    /* -- Create a new ring -- */
+
+    /* local declarations */
+    ARNETWORK_BroadcastRing_t* ring = NULL;
+
+    if ((numberOfCell == 0) || (maxNumberOfSubscribers <= 0))
+        return NULL;
+
+    ring = calloc(1, sizeof(ARNETWORK_BroadcastRing_t));
+    if (ring == NULL)
+        return NULL;
+
+    ring->numberOfCell = numberOfCell;
+    ring->cellSize = cellSize;
+    ring->writePosition = 0;
+    ring->maxNumberOfSubscribers = maxNumberOfSubscribers;
+
+    ring->cellBuffer = malloc(numberOfCell * cellSize);
+    ring->dataSizeArr = calloc(numberOfCell, sizeof(int));
+    ring->readPositionArr = calloc(maxNumberOfSubscribers, sizeof(uint64_t));
+    ring->isSubscribedArr = calloc(maxNumberOfSubscribers, sizeof(uint8_t));
+    if ((ring->cellBuffer == NULL) || (ring->dataSizeArr == NULL) || (ring->readPositionArr == NULL) || (ring->isSubscribedArr == NULL))
+    {
+        ARNETWORK_BroadcastRing_Delete(&ring);
+        return NULL;
+    }
+
+    return ring;
+}
+
+void ARNETWORK_BroadcastRing_Delete(ARNETWORK_BroadcastRing_t **ring)
+{
+    /* -- Delete the ring -- */
+
+    if (ring != NULL)
+    {
+        if((*ring) != NULL)
+        {
+            free((*ring)->cellBuffer);
+            free((*ring)->dataSizeArr);
+            free((*ring)->readPositionArr);
+            free((*ring)->isSubscribedArr);
+
+            free(*ring);
+            (*ring) = NULL;
+        }
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_PushBack(ARNETWORK_BroadcastRing_t *ring, const uint8_t *data, int dataSize)
+{
+    /* -- Add a data for all the subscribers -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    unsigned int cellIndex = 0;
+
+    if ((dataSize < 0) || ((unsigned int) dataSize > ring->cellSize))
+    {
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+    else
+    {
+        /* the oldest data is overwritten: the subscribers which did not read it skip it */
+        cellIndex = ring->writePosition % ring->numberOfCell;
+        memcpy(ring->cellBuffer + (cellIndex * ring->cellSize), data, dataSize);
+        ring->dataSizeArr[cellIndex] = dataSize;
+        ring->writePosition++;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Subscribe(ARNETWORK_BroadcastRing_t *ring, int *subscriberPtr)
+{
+    /* -- Add a subscriber -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_ERROR_BUFFER_SIZE;
+    int subscriber = 0;
+
+    for (subscriber = 0; (subscriber < ring->maxNumberOfSubscribers) && (error != ARNETWORK_OK); ++subscriber)
+    {
+        if (!ring->isSubscribedArr[subscriber])
+        {
+            /* the subscriber reads the data added after its subscription */
+            ring->isSubscribedArr[subscriber] = 1;
+            ring->readPositionArr[subscriber] = ring->writePosition;
+            *subscriberPtr = subscriber;
+            error = ARNETWORK_OK;
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Unsubscribe(ARNETWORK_BroadcastRing_t *ring, int subscriber)
+{
+    /* -- Remove a subscriber -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if (ARNETWORK_BroadcastRing_IsSubscribed(ring, subscriber))
+    {
+        ring->isSubscribedArr[subscriber] = 0;
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Read(ARNETWORK_BroadcastRing_t *ring, int subscriber, uint8_t *data, int dataLimitSize, int *readSizePtr, int *numberOfDataLostPtr)
+{
+    /* -- Read the next data of a subscriber -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    uint64_t numberOfDataLost = 0;
+    unsigned int cellIndex = 0;
+    int readSize = 0;
+
+    if (!ARNETWORK_BroadcastRing_IsSubscribed(ring, subscriber))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else
+    {
+        /* the data overwritten by the writer since the last reading are skipped */
+        if ((ring->writePosition - ring->readPositionArr[subscriber]) > ring->numberOfCell)
+        {
+            numberOfDataLost = ring->writePosition - ring->numberOfCell - ring->readPositionArr[subscriber];
+            ring->readPositionArr[subscriber] += numberOfDataLost;
+        }
+
+        if (ring->readPositionArr[subscriber] == ring->writePosition)
+        {
+            error = ARNETWORK_ERROR_BUFFER_EMPTY;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        cellIndex = ring->readPositionArr[subscriber] % ring->numberOfCell;
+        if (ring->dataSizeArr[cellIndex] <= dataLimitSize)
+        {
+            readSize = ring->dataSizeArr[cellIndex];
+            memcpy(data, ring->cellBuffer + (cellIndex * ring->cellSize), readSize);
+            ring->readPositionArr[subscriber]++;
+        }
+        else
+        {
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+    }
+
+    if (readSizePtr != NULL)
+    {
+        *readSizePtr = readSize;
+    }
+    *numberOfDataLostPtr = (numberOfDataLost > INT32_MAX) ? INT32_MAX : (int) numberOfDataLost;
+
+    return error;
+}
+
+int ARNETWORK_BroadcastRing_HasData(ARNETWORK_BroadcastRing_t *ring, int subscriber)
+{
+    /* -- Check if a subscriber has a data to read -- */
+
+    return (ARNETWORK_BroadcastRing_IsSubscribed(ring, subscriber) && (ring->readPositionArr[subscriber] != ring->writePosition)) ? 1 : 0;
+}
+
+int ARNETWORK_BroadcastRing_IsSubscribed(ARNETWORK_BroadcastRing_t *ring, int subscriber)
+{
+    /* -- Check if a subscriber is known -- */
+
+    return ((subscriber >= 0) && (subscriber < ring->maxNumberOfSubscribers) && (ring->isSubscribedArr[subscriber])) ? 1 : 0;
+}
+
+void ARNETWORK_BroadcastRing_Clean(ARNETWORK_BroadcastRing_t *ring)
+{
+    /* -- Discard the data not read by the subscribers -- */
+
+    /* local declarations */
+    int subscriber = 0;
+
+    for (subscriber = 0; subscriber < ring->maxNumberOfSubscribers; ++subscriber)
+    {
+        ring->readPositionArr[subscriber] = ring->writePosition;
+    }
+}
@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_BroadcastRing.h
+ * @brief Ring shared by several subscribers, each reading it with its own cursor.
+ * @date 10/18/2026
+**/
+
+#ifndef _ARNETWORK_BROADCASTRING_PRIVATE_H_
+#define _ARNETWORK_BROADCASTRING_PRIVATE_H_
+
+#include <inttypes.h>
+#include <libARNetwork/ARNETWORK_Error.h>
+
+/**
+ * @brief Ring of data read by several subscribers
+ * @details The writer always adds the data, overwriting the oldest one when the ring is full: it never waits for the subscribers.
+ * Each subscriber reads the data in the order of their positions, from its own read position ; a subscriber overrun by the writer skips the data overwritten.
+ * @warning The ring is not multithread safe: its functions must be called with the mutex of its owner locked.
+ * @warning before to be used the ring must be created through ARNETWORK_BroadcastRing_New()
+ * @post after its using the ring must be deleted through ARNETWORK_BroadcastRing_Delete()
+**/
+typedef struct
+{
+    uint8_t *cellBuffer; /**< the data buffer */
+    int *dataSizeArr; /**< Size of the data of each cell */
+    unsigned int numberOfCell; /**< Maximum number of data stored */
+    unsigned int cellSize; /**< Size of one data cell in byte */
+
+    uint64_t writePosition; /**< Number of data written since the creation of the ring */
+    uint64_t *readPositionArr; /**< Position of the next data read by each subscriber */
+    uint8_t *isSubscribedArr; /**< Indicator of subscriber slot used (1 = true | 0 = false) */
+    int maxNumberOfSubscribers; /**< Number of subscriber slots */
+
+}ARNETWORK_BroadcastRing_t;
+
+/**
+ * @brief Create a new ring
+ * @warning This function allocate memory
+ * @post ARNETWORK_BroadcastRing_Delete() must be called to delete the ring and free the memory allocated
+ * @param[in] numberOfCell Maximum number of data stored
+ * @param[in] cellSize size of one data cell
+ * @param[in] maxNumberOfSubscribers maximum number of subscribers at the same time
+ * @return Pointer on the new ring
+ * @see ARNETWORK_BroadcastRing_Delete()
+**/
+ARNETWORK_BroadcastRing_t* ARNETWORK_BroadcastRing_New(unsigned int numberOfCell, unsigned int cellSize, int maxNumberOfSubscribers);
+
+/**
+ * @brief Delete the ring
+ * @warning This function free memory
+ * @param ring Pointer to the ring to delete
+ * @see ARNETWORK_BroadcastRing_New()
+**/
+void ARNETWORK_BroadcastRing_Delete(ARNETWORK_BroadcastRing_t **ring);
+
+/**
+ * @brief Add a data for all the subscribers, overwriting the oldest data if the ring is full
+ * @param ring the ring
+ * @param[in] data the data to add
+ * @param[in] dataSize size of the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the data is larger than a cell
+**/
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_PushBack(ARNETWORK_BroadcastRing_t *ring, const uint8_t *data, int dataSize);
+
+/**
+ * @brief Add a subscriber, which reads the data added after its subscription
+ * @param ring the ring
+ * @param[out] subscriberPtr pointer to store the identifier of the subscriber
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if all the subscriber slots are used
+ * @see ARNETWORK_BroadcastRing_Unsubscribe()
+**/
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Subscribe(ARNETWORK_BroadcastRing_t *ring, int *subscriberPtr);
+
+/**
+ * @brief Remove a subscriber
+ * @param ring the ring
+ * @param[in] subscriber identifier of the subscriber
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BAD_PARAMETER if the subscriber is unknown
+ * @see ARNETWORK_BroadcastRing_Subscribe()
+**/
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Unsubscribe(ARNETWORK_BroadcastRing_t *ring, int subscriber);
+
+/**
+ * @brief Read the next data of a subscriber
+ * @details the data overwritten before the subscriber read them are skipped and counted in numberOfDataLostPtr.
+ * @param ring the ring
+ * @param[in] subscriber identifier of the subscriber
+ * @param[out] data The data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSizePtr pointer to store the size of the data read ; can be equal to NULL
+ * @param[out] numberOfDataLostPtr pointer to store the number of data skipped, set even if an error occurs
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_EMPTY if the subscriber read all the data ; ARNETWORK_ERROR_BUFFER_SIZE, without reading the data, if it does not fit in data
+**/
+eARNETWORK_ERROR ARNETWORK_BroadcastRing_Read(ARNETWORK_BroadcastRing_t *ring, int subscriber, uint8_t *data, int dataLimitSize, int *readSizePtr, int *numberOfDataLostPtr);
+
+/**
+ * @brief Check if a subscriber has a data to read
+ * @param ring the ring
+ * @param[in] subscriber identifier of the subscriber
+ * @return 1 if the subscriber has a data to read, otherwise 0
+**/
+int ARNETWORK_BroadcastRing_HasData(ARNETWORK_BroadcastRing_t *ring, int subscriber);
+
+/**
+ * @brief Check if a subscriber is known
+ * @param ring the ring
+ * @param[in] subscriber identifier of the subscriber
+ * @return 1 if the subscriber is subscribed, otherwise 0
+**/
+int ARNETWORK_BroadcastRing_IsSubscribed(ARNETWORK_BroadcastRing_t *ring, int subscriber);
+
+/**
+ * @brief Discard the data not read by the subscribers
+ * @param ring the ring
+**/
+void ARNETWORK_BroadcastRing_Clean(ARNETWORK_BroadcastRing_t *ring);
+
+#endif /** _ARNETWORK_BROADCASTRING_PRIVATE_H_ */
@@ -0,0 +1,276 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Buffer.c
+ * @brief Reference-counted buffers from a lock-free pool.
+ * @date 10/18/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ ******************************************/
+
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <libARSAL/ARSAL_Print.h>
+
+#include <libARNetwork/ARNETWORK_Error.h>
+#include "ARNETWORK_Buffer.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ ******************************************/
+
+#define ARNETWORK_BUFFER_TAG "ARNETWORK_Buffer"
+
+#define ARNETWORK_BUFFER_DATA_ALIGNMENT (8) /**< alignment of the data of the buffers */
+#define ARNETWORK_BUFFERPOOL_INDEX_MASK (0xFFFFFFFFull) /**< mask of the buffer index in the head of the free list */
+#define ARNETWORK_BUFFERPOOL_TAG_UNIT (0x100000000ull) /**< increment of the changes count in the head of the free list */
+
+/*****************************************
+ *
+ *             internal functions :
+ *
+ ******************************************/
+
+/**
+ * @brief Release one reference on a pool, and free it after the last one
+ * @param pool the pool
+**/
+static void ARNETWORK_BufferPool_Unref (ARNETWORK_BufferPool_t *pool)
+{
+    if (__atomic_sub_fetch (&(pool->refCount), 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        free (pool->dataBlock);
+        free (pool->bufferArr);
+        free (pool);
+    }
+}
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ ******************************************/
+
+ARNETWORK_BufferPool_t* ARNETWORK_BufferPool_New (int numberOfBuffers, int bufferCapacity, eARNETWORK_ERROR *error)
+{
+    /** -- Create a new pool of buffers -- */
+
+    /** local declarations */
+    ARNETWORK_BufferPool_t *pool = NULL;
+    eARNETWORK_ERROR localError = ARNETWORK_OK;
+    size_t dataStride = 0;
+    int bufferIndex = 0;
+
+    if ((numberOfBuffers <= 0) || (bufferCapacity <= 0))
+    {
+        localError = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        pool = calloc (1, sizeof (ARNETWORK_BufferPool_t));
+        if (pool == NULL)
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        dataStride = ((size_t) bufferCapacity + ARNETWORK_BUFFER_DATA_ALIGNMENT - 1) & ~((size_t) ARNETWORK_BUFFER_DATA_ALIGNMENT - 1);
+        pool->bufferArr = calloc (numberOfBuffers, sizeof (ARNETWORK_Buffer_t));
+        pool->dataBlock = malloc (dataStride * numberOfBuffers);
+        if ((pool->bufferArr == NULL) || (pool->dataBlock == NULL))
+        {
+            localError = ARNETWORK_ERROR_ALLOC;
+        }
+    }
+
+    if (localError == ARNETWORK_OK)
+    {
+        pool->numberOfBuffers = numberOfBuffers;
+        pool->refCount = 1;
+
+        /** all the buffers are free, in the order of their index */
+        for (bufferIndex = 0; bufferIndex < numberOfBuffers; ++bufferIndex)
+        {
+            pool->bufferArr[bufferIndex].pool = pool;
+            pool->bufferArr[bufferIndex].data = pool->dataBlock + (dataStride * bufferIndex);
+            pool->bufferArr[bufferIndex].capacity = bufferCapacity;
+            pool->bufferArr[bufferIndex].nextFreeIndex = (bufferIndex + 1 < numberOfBuffers) ? (uint32_t) (bufferIndex + 2) : 0;
+        }
+        pool->freeListHead = 1;
+    }
+    else if (pool != NULL)
+    {
+        free (pool->dataBlock);
+        free (pool->bufferArr);
+        free (pool);
+        pool = NULL;
+    }
+
+    if (error != NULL)
+    {
+        *error = localError;
+    }
+
+    return pool;
+}
+
+void ARNETWORK_BufferPool_Delete (ARNETWORK_BufferPool_t **poolPtrAddr)
+{
+    /** -- Delete a pool of buffers -- */
+
+    if ((poolPtrAddr != NULL) && (*poolPtrAddr != NULL))
+    {
+        /** the buffers still taken keep the pool alive */
+        ARNETWORK_BufferPool_Unref (*poolPtrAddr);
+        *poolPtrAddr = NULL;
+    }
+}
+
+ARNETWORK_Buffer_t* ARNETWORK_BufferPool_GetBuffer (ARNETWORK_BufferPool_t *pool)
+{
+    /** -- Take a free buffer from the pool -- */
+
+    /** local declarations */
+    ARNETWORK_Buffer_t *buffer = NULL;
+    uint64_t head = 0;
+    uint64_t newHead = 0;
+    uint32_t nextFreeIndex = 0;
+
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    head = __atomic_load_n (&(pool->freeListHead), __ATOMIC_ACQUIRE);
+    do
+    {
+        if ((head & ARNETWORK_BUFFERPOOL_INDEX_MASK) == 0)
+        {
+            return NULL;
+        }
+
+        /** the next index read can be outdated if another thread takes the buffer first: the changes count makes the exchange fail */
+        buffer = &(pool->bufferArr[(head & ARNETWORK_BUFFERPOOL_INDEX_MASK) - 1]);
+        nextFreeIndex = __atomic_load_n (&(buffer->nextFreeIndex), __ATOMIC_RELAXED);
+        newHead = ((head & ~ARNETWORK_BUFFERPOOL_INDEX_MASK) + ARNETWORK_BUFFERPOOL_TAG_UNIT) | nextFreeIndex;
+    } while (!__atomic_compare_exchange_n (&(pool->freeListHead), &head, newHead, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    __atomic_add_fetch (&(pool->refCount), 1, __ATOMIC_RELAXED);
+    buffer->size = 0;
+    __atomic_store_n (&(buffer->refCount), 1, __ATOMIC_RELAXED);
+
+    return buffer;
+}
+
+uint8_t* ARNETWORK_Buffer_GetData (ARNETWORK_Buffer_t *buffer)
+{
+    return (buffer != NULL) ? buffer->data : NULL;
+}
+
+int ARNETWORK_Buffer_GetCapacity (ARNETWORK_Buffer_t *buffer)
+{
+    return (buffer != NULL) ? buffer->capacity : 0;
+}
+
+int ARNETWORK_Buffer_GetSize (ARNETWORK_Buffer_t *buffer)
+{
+    return (buffer != NULL) ? buffer->size : 0;
+}
+
+eARNETWORK_ERROR ARNETWORK_Buffer_SetSize (ARNETWORK_Buffer_t *buffer, int size)
+{
+    /** -- Set the size of the data of a buffer -- */
+
+    if ((buffer == NULL) || (size < 0) || (size > buffer->capacity))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    buffer->size = size;
+
+    return ARNETWORK_OK;
+}
+
+void ARNETWORK_Buffer_Ref (ARNETWORK_Buffer_t *buffer)
+{
+    if (buffer != NULL)
+    {
+        __atomic_add_fetch (&(buffer->refCount), 1, __ATOMIC_RELAXED);
+    }
+}
+
+void ARNETWORK_Buffer_Unref (ARNETWORK_Buffer_t *buffer)
+{
+    /** -- Release one reference on a buffer -- */
+
+    /** local declarations */
+    ARNETWORK_BufferPool_t *pool = NULL;
+    uint64_t head = 0;
+    uint64_t newHead = 0;
+    int refCount = 0;
+
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    refCount = __atomic_sub_fetch (&(buffer->refCount), 1, __ATOMIC_ACQ_REL);
+    if (refCount > 0)
+    {
+        return;
+    }
+    if (refCount < 0)
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_BUFFER_TAG, "buffer %p released more than referenced", buffer);
+        return;
+    }
+
+    /** the last reference is released: push the buffer on the free list of its pool */
+    pool = buffer->pool;
+    head = __atomic_load_n (&(pool->freeListHead), __ATOMIC_RELAXED);
+    do
+    {
+        __atomic_store_n (&(buffer->nextFreeIndex), (uint32_t) (head & ARNETWORK_BUFFERPOOL_INDEX_MASK), __ATOMIC_RELAXED);
+        newHead = ((head & ~ARNETWORK_BUFFERPOOL_INDEX_MASK) + ARNETWORK_BUFFERPOOL_TAG_UNIT) | (uint64_t) ((buffer - pool->bufferArr) + 1);
+    } while (!__atomic_compare_exchange_n (&(pool->freeListHead), &head, newHead, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    ARNETWORK_BufferPool_Unref (pool);
+}
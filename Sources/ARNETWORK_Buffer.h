@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_Buffer.h
+ * @brief Reference-counted buffers from a lock-free pool.
+ * @date 10/18/2026
+**/
+
+#ifndef _ARNETWORK_BUFFER_PRIVATE_H_
+#define _ARNETWORK_BUFFER_PRIVATE_H_
+
+#include <inttypes.h>
+#include <libARNetwork/ARNETWORK_Buffer.h>
+
+/**
+ * @brief reference-counted buffer of a pool
+**/
+struct ARNETWORK_Buffer_t
+{
+    ARNETWORK_BufferPool_t *pool; /**< Pool of the buffer */
+    uint8_t *data; /**< Data of the buffer, in the data block of the pool */
+    int capacity; /**< Maximum size of the data in byte */
+    int size; /**< Size of the data in byte */
+    int refCount; /**< Number of references on the buffer ; accessed atomically */
+    uint32_t nextFreeIndex; /**< Index + 1 of the next free buffer of the pool while the buffer is free, 0 for none ; accessed atomically */
+};
+
+/**
+ * @brief pool of buffers, with a lock-free stack of the free buffers
+**/
+struct ARNETWORK_BufferPool_t
+{
+    ARNETWORK_Buffer_t *bufferArr; /**< The buffers of the pool */
+    uint8_t *dataBlock; /**< Data of all the buffers */
+    int numberOfBuffers; /**< Number of buffers of the pool */
+    uint64_t freeListHead; /**< Index + 1 of the first free buffer in the low 32 bits, changes count in the high 32 bits against the ABA problem ; accessed atomically */
+    int refCount; /**< 1 until the pool is deleted, plus 1 per buffer taken ; accessed atomically */
+};
+
+#endif /** _ARNETWORK_BUFFER_PRIVATE_H_ */
@@ -38,8 +38,10 @@
 #ifndef _ARNETWORK_DATADESCRIPTOR_PRIVATE_H_
 #define _ARNETWORK_DATADESCRIPTOR_PRIVATE_H_
 
+#include <time.h>
 #include <libARNetwork/ARNETWORK_Error.h>
 #include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_Buffer.h>
 
 /*****************************************
  * 
@@ -63,6 +65,13 @@ typedef struct
     void *customData; /**< custom data */
     ARNETWORK_Manager_Callback_t callback; /**< call back use when the data are sent or timeout occurred */
     int isUsingDataCopy; /**< Indicator of using copy of data */
+    int hasKey; /**< Indicator of coalescing key validity (1 = the data can be coalesced | 0 = never coalesced) */
+    uint32_t key; /**< Coalescing key of the data */
+    int hasSendTime; /**< Indicator of sending date validity (1 = the data is not sent before sendTime | 0 = sent as soon as possible) */
+    struct timespec sendTime; /**< Monotonic date before which the data is not sent */
+    uint32_t handle; /**< Handle of the data given to the application, 0 if none */
+    int isCanceled; /**< Indicator of data canceled while queued behind other data ; it is popped without being sent */
+    ARNETWORK_Buffer_t *buffer; /**< Reference-counted buffer holding the data, released when the data is freed ; NULL if none */
     
 }ARNETWORK_DataDescriptor_t;
 
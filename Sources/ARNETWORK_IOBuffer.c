@@ -42,9 +42,15 @@
  ******************************************/
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <errno.h>
 
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+#include <unistd.h>
+#include <sys/eventfd.h>
+#endif
+
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Mutex.h>
 
@@ -65,6 +71,9 @@
 #define ARNETWORK_IOBUFFER_TAG "ARNETWORK_IOBuffer"
 #define ARNETWORK_IOBUFFER_MAXSEQVALUE (256)
 #define ARNETWORK_IOBUFFER_DELTASEQ (-10)
+#define ARNETWORK_IOBUFFER_RATELIMIT_TOKEN_SCALE (1000000) /**< number of token units in a rateLimitUnit: one token unit per microsecond at a rate of 1 */
+#define ARNETWORK_IOBUFFER_RATELIMIT_MAX_REFILL_US (1000000000) /**< maximum time counted in a refill, to avoid overflows */
+#define ARNETWORK_IOBUFFER_READBATCH_CHUNK_SIZE (16) /**< number of data descriptors read at once by ARNETWORK_IOBuffer_ReadDataBatch() */
 
 /**
  * @brief free the data pointed by the data descriptor
@@ -101,377 +110,1666 @@ static inline eARNETWORK_ERROR ARNETWORK_IOBuffer_FreeData(ARNETWORK_IOBuffer_t
     {
         dataDescriptor->callback(IOBuffer->ID, NULL, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
     }
+
+    /** release the reference of the IOBuffer on the buffer of the data */
+    ARNETWORK_Buffer_Unref(dataDescriptor->buffer);
     
     return error;
 }
 
-/*****************************************
- *
- *             implementation :
- *
- ******************************************/
-
-ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *param, int isInternal)
+/**
+ * @brief write the slot of a latest only output buffer, as the writer of its seqlock
+ * @param IOBuffer The latest only output buffer
+ * @param data The data to write ; can be equal to NULL if dataSize is -1
+ * @param dataSize size of the data, at most latestDataCapacity (-1 = empty the slot)
+ **/
+static inline void ARNETWORK_IOBuffer_SetLatestData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize)
 {
-    /** -- Create a new input or output buffer -- */
+    /** -- write the slot of a latest only output buffer -- */
 
     /** local declarations */
-    ARNETWORK_IOBuffer_t *IOBuffer = NULL;
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-    int res = 0;
-
-    if (param == NULL)
-        return NULL;
-
-    /** Create the input or output buffer in accordance with parameters set in the ARNETWORK_IOBufferParam_t */
-    IOBuffer = calloc(1, sizeof(ARNETWORK_IOBuffer_t));
-    if (IOBuffer == NULL)
-        return NULL;
-
-    /** Initialize to default values */
-    IOBuffer->dataDescriptorRBuffer = NULL;
-    IOBuffer->dataCopyRBuffer = NULL;
-    res = ARSAL_Mutex_Init(&(IOBuffer->mutex));
-    if (res != 0) {
-        error = ARNETWORK_ERROR_MUTEX;
-        goto error;
-    }
-    res = ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
-    if (res < 0) {
-        error = ARNETWORK_ERROR_SEMAPHORE;
-        goto error;
-    }
-
-    if (!isInternal) {
-        res = ARNETWORK_IOBufferParam_Check(param);
-        if (res < 0) {
-            error = ARNETWORK_ERROR_BAD_PARAMETER;
-            goto error;
-        }
-    }
-
-    IOBuffer->ID = param->ID;
-    IOBuffer->dataType = param->dataType;
-    IOBuffer->sendingWaitTimeMs = param->sendingWaitTimeMs;
-    IOBuffer->ackTimeoutMs = param->ackTimeoutMs;
-
-    if (param->numberOfRetry >= 0) {
-        IOBuffer->numberOfRetry = param->numberOfRetry;
-    } else {
-        /** if numberOfRetry equal 0 disable the retry function with -1 value */
-        IOBuffer->numberOfRetry = -1;
-    }
-
-    IOBuffer->isWaitAck = 0;
-    IOBuffer->seq = 0;
-    IOBuffer->alreadyHadData = 0;
-    IOBuffer->nbPackets = 0;
-    IOBuffer->nbNetwork = 0;
-    IOBuffer->waitTimeCount = param->sendingWaitTimeMs;
-    IOBuffer->ackWaitTimeCount = param->ackTimeoutMs;
-    IOBuffer->retryCount = 0;
+    uint32_t sequence = IOBuffer->latestSequence;
 
-    /** Create the RingBuffer for the information of the data*/
-    IOBuffer->dataDescriptorRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t), param->isOverwriting);
-    if (IOBuffer->dataDescriptorRBuffer == NULL) {
-        error = ARNETWORK_ERROR_NEW_RINGBUFFER;
-        goto error;
-    }
+    /** an odd sequence tells the readers the slot is being written */
+    __atomic_store_n(&(IOBuffer->latestSequence), sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
 
-    /** if the parameters have a size of data copy */
-    if (param->dataCopyMaxSize > 0) {
-        /** Create the RingBuffer for the copy of the data*/
-        IOBuffer->dataCopyRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, param->dataCopyMaxSize, param->isOverwriting);
-        if (IOBuffer->dataCopyRBuffer == NULL) {
-            error = ARNETWORK_ERROR_NEW_BUFFER;
-            goto error;
-        }
+    if (dataSize > 0)
+    {
+        memcpy(IOBuffer->latestData, data, dataSize);
     }
+    __atomic_store_n(&(IOBuffer->latestDataSize), dataSize, __ATOMIC_RELAXED);
 
-    return IOBuffer;
-
-error:
-    /** delete the inOutput buffer if an error occurred */
-    ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG,"error: %s", ARNETWORK_Error_ToString (error));
-    ARNETWORK_IOBuffer_Delete(&IOBuffer);
-    return NULL;
+    __atomic_store_n(&(IOBuffer->latestSequence), sequence + 2, __ATOMIC_RELEASE);
 }
 
-void ARNETWORK_IOBuffer_Delete(ARNETWORK_IOBuffer_t **IOBuffer)
+/**
+ * @brief replace in place the queued data having the same coalescing key as the new data
+ * @details the data replaced is canceled: its callback is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status, then it is freed.
+ * @param IOBuffer The IOBuffer
+ * @param newDataDescriptor The data descriptor of the new data
+ * @param doDataCopy indicator to copy the new data in the IOBuffer
+ * @param segmentArr segments of the new data to copy
+ * @param numberOfSegments number of segments in segmentArr
+ * @return 1 if a data has been replaced, otherwise 0
+ **/
+static int ARNETWORK_IOBuffer_CoalesceData(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_DataDescriptor_t *newDataDescriptor, int doDataCopy, const struct iovec *segmentArr, int numberOfSegments)
 {
-    /** -- Delete the input or output buffer -- */
+    /** -- replace the queued data having the same coalescing key -- */
 
     /** local declarations */
+    ARNETWORK_DataDescriptor_t *queuedDataDescriptor = NULL;
+    ARNETWORK_DataDescriptor_t replacedDataDescriptor;
+    unsigned int dataIndex = 0;
+    size_t offset = 0;
+    int segmentIndex = 0;
+
+    /** the front data is being sent while waiting an acknowledgement ; it can not be replaced */
+    if (IOBuffer->isWaitAck)
+    {
+        dataIndex = 1;
+    }
 
-    if(IOBuffer != NULL)
+    for (queuedDataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, dataIndex);
+         queuedDataDescriptor != NULL;
+         queuedDataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, ++dataIndex))
     {
-        if((*IOBuffer) != NULL)
+        /** the copies are stored in the order of their data descriptors; only a data of the same kind can take the place */
+        if ((queuedDataDescriptor->hasKey) &&
+            (queuedDataDescriptor->key == newDataDescriptor->key) &&
+            (queuedDataDescriptor->isUsingDataCopy == ((doDataCopy) ? 1 : 0)))
         {
-            ARSAL_Mutex_Destroy(&((*IOBuffer)->mutex));
-            ARSAL_Sem_Destroy(&((*IOBuffer)->outputSem));
-
-            ARNETWORK_IOBuffer_CancelAllData((*IOBuffer));
-
-            ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataDescriptorRBuffer));
-            ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataCopyRBuffer));
-
-            free((*IOBuffer));
-            (*IOBuffer) = NULL;
+            break;
         }
     }
-}
-
-eARNETWORK_ERROR ARNETWORK_IOBuffer_AckReceived(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t seqNumber)
-{
-    /** -- Receive an acknowledgement to a IOBuffer -- */
-
-    /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
 
-    /** delete the data if the sequence number received is same as the sequence number expected */
-    if(IOBuffer->isWaitAck && IOBuffer->seq == seqNumber)
+    if (queuedDataDescriptor == NULL)
     {
-        IOBuffer->isWaitAck = 0;
-        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED);
+        return 0;
     }
-    else
+
+    replacedDataDescriptor = *queuedDataDescriptor;
+
+    if (replacedDataDescriptor.isUsingDataCopy)
     {
-        error = ARNETWORK_ERROR_IOBUFFER_BAD_ACK;
+        /** reuse the cell of the data copy replaced */
+        for (segmentIndex = 0; segmentIndex < numberOfSegments; ++segmentIndex)
+        {
+            memcpy(replacedDataDescriptor.data + offset, segmentArr[segmentIndex].iov_base, segmentArr[segmentIndex].iov_len);
+            offset += segmentArr[segmentIndex].iov_len;
+        }
+        newDataDescriptor->data = replacedDataDescriptor.data;
+        newDataDescriptor->isUsingDataCopy = 1;
     }
 
-    return error;
-}
+    *queuedDataDescriptor = *newDataDescriptor;
 
-int ARNETWORK_IOBuffer_IsWaitAck(ARNETWORK_IOBuffer_t *IOBuffer)
-{
-    /** -- Get if the IOBuffer is waiting an acknowledgement -- */
+    /** callback with cancel status, then free the data replaced (its copy cell is reused) */
+    if (replacedDataDescriptor.callback != NULL)
+    {
+        replacedDataDescriptor.callback(IOBuffer->ID, replacedDataDescriptor.data, replacedDataDescriptor.customData, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
 
-    /** local declarations */
-    int isWaitAckCpy = 0;
+        if (!replacedDataDescriptor.isUsingDataCopy)
+        {
+            replacedDataDescriptor.callback(IOBuffer->ID, replacedDataDescriptor.data, replacedDataDescriptor.customData, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
+        }
 
-    isWaitAckCpy = IOBuffer->isWaitAck;
+        replacedDataDescriptor.callback(IOBuffer->ID, NULL, replacedDataDescriptor.customData, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
+    }
 
-    return isWaitAckCpy;
+    ARNETWORK_Buffer_Unref(replacedDataDescriptor.buffer);
+
+    return 1;
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_Lock( ARNETWORK_IOBuffer_t *IOBuffer)
+/**
+ * @brief find the data of a handle in the IOBuffer
+ * @param IOBuffer The IOBuffer
+ * @param[in] handle handle of the data
+ * @param[out] dataIndexPtr index of the data in the IOBuffer
+ * @return pointer on the data descriptor of the data, or NULL if no data has this handle
+ **/
+static ARNETWORK_DataDescriptor_t *ARNETWORK_IOBuffer_FindData(ARNETWORK_IOBuffer_t *IOBuffer, uint32_t handle, unsigned int *dataIndexPtr)
 {
-    /** -- Lock the IOBuffer's mutex -- **/
+    /** -- find the data of a handle in the IOBuffer -- */
 
     /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-    int lockingReturn = 0;
-
-    /** lock the IOBuffer */
-    lockingReturn = ARSAL_Mutex_Lock(&(IOBuffer->mutex));
+    ARNETWORK_DataDescriptor_t *dataDescriptor = NULL;
+    unsigned int dataIndex = 0;
 
-    if(lockingReturn != 0)
+    for (dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, dataIndex);
+         dataDescriptor != NULL;
+         dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, ++dataIndex))
     {
-        switch(lockingReturn)
+        if ((dataDescriptor->handle == handle) && (!dataDescriptor->isCanceled))
         {
-        case EDEADLK:
-            error = ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK;
-            break;
-
-        default:
-            error = ARNETWORK_ERROR_MUTEX;
-            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_IOBUFFER_TAG, "locking return : %d unexpected", lockingReturn);
             break;
         }
     }
 
-    return error;
+    *dataIndexPtr = dataIndex;
+    return dataDescriptor;
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_Unlock( ARNETWORK_IOBuffer_t *IOBuffer)
+/**
+ * @brief update the writable eventfd of the IOBuffer, if it is created
+ * @details the eventfd counter is not 0 while the IOBuffer is writable, and 0 while it is full.
+ * The producers of a lock-free IOBuffer can change its state during the update: the eventfd is updated until the state is stable.
+ * @param IOBuffer The IOBuffer
+ **/
+static void ARNETWORK_IOBuffer_UpdateWritableEventFd(ARNETWORK_IOBuffer_t *IOBuffer)
 {
-    /** -- Unlock the IOBuffer's mutex -- **/
-
+#ifdef ENABLE_MONITOR_INCOMING_DATA
     /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-    int unlockingReturn = 0;
+    int eventFd = __atomic_load_n(&(IOBuffer->writableEventFd), __ATOMIC_ACQUIRE);
+    uint64_t value = 1;
+    int isFull = 0;
+    int ret = 0;
 
-    /** unlock the IOBuffer if there is not correctly unlocked */
-    unlockingReturn = ARSAL_Mutex_Unlock(&(IOBuffer->mutex));
-
-    if(unlockingReturn != 0)
+    if (eventFd >= 0)
     {
-        switch(unlockingReturn)
+        do
         {
-        case EDEADLK:
-            error = ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK;
-            break;
+            isFull = ARNETWORK_IOBuffer_IsFull(IOBuffer);
+            do
+            {
+                value = 1;
+                ret = (isFull) ? read(eventFd, &value, sizeof(value)) : write(eventFd, &value, sizeof(value));
+            } while ((ret < 0) && (errno == EINTR));
 
-        default:
-            error = ARNETWORK_ERROR_MUTEX;
-            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_IOBUFFER_TAG, "unlocking return : %d unexpected", unlockingReturn);
-            break;
-        }
+            /** reading an eventfd already at 0 fails with EAGAIN, which is expected */
+            if ((ret < 0) && (errno != EAGAIN))
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG, "[%d] Error: can't update the writable eventfd %s", IOBuffer->ID, strerror(errno));
+            }
+        } while (isFull != ARNETWORK_IOBuffer_IsFull(IOBuffer));
     }
+#else
+    (void) IOBuffer;
+#endif
+}
 
-    return error;
+/**
+ * @brief notify the producers waiting for a free cell in the IOBuffer
+ * @param IOBuffer The IOBuffer, which was full before a data was popped
+ **/
+static void ARNETWORK_IOBuffer_NotifyWritable(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    if (IOBuffer->writableWaitersCount > 0)
+    {
+        ARSAL_Cond_Broadcast(&(IOBuffer->writableCond));
+    }
+    ARNETWORK_IOBuffer_UpdateWritableEventFd(IOBuffer);
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_CancelAllData(ARNETWORK_IOBuffer_t *IOBuffer)
+/**
+ * @brief take a cell of a lock-free IOBuffer for a new data
+ * @param IOBuffer The lock-free IOBuffer
+ * @param[out] wasEmptyPtr set to 1 if the IOBuffer was empty ; can be equal to NULL
+ * @return 1 if a cell is taken, 0 if the IOBuffer is full
+ **/
+static int ARNETWORK_IOBuffer_TakeLockFreeCell(ARNETWORK_IOBuffer_t *IOBuffer, int *wasEmptyPtr)
 {
-    /** -- cancel all remaining data -- */
+    /** -- take a cell of a lock-free IOBuffer -- */
 
     /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-    eARNETWORK_ERROR deleteError = ARNETWORK_OK;
+    int numberOfFreeCells = __atomic_load_n(&(IOBuffer->lockFreeNumberOfFreeCells), __ATOMIC_RELAXED);
 
-    /** pop all data with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status */
-    while(deleteError == ARNETWORK_OK)
+    do
     {
-        deleteError = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        if (numberOfFreeCells <= 0)
+        {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&(IOBuffer->lockFreeNumberOfFreeCells), &numberOfFreeCells, numberOfFreeCells - 1, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    if (wasEmptyPtr != NULL)
+    {
+        *wasEmptyPtr = (numberOfFreeCells == (int)IOBuffer->dataDescriptorRBuffer->numberOfCell) ? 1 : 0;
     }
 
-    if(deleteError != ARNETWORK_ERROR_BUFFER_EMPTY)
+    /** the last cell is taken */
+    if (numberOfFreeCells == 1)
     {
-        error = deleteError;
+        ARNETWORK_IOBuffer_UpdateWritableEventFd(IOBuffer);
     }
 
-    return error;
+    return 1;
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_PopData(ARNETWORK_IOBuffer_t *IOBuffer)
+/**
+ * @brief give back the cell of a data popped from a lock-free IOBuffer
+ * @param IOBuffer The lock-free IOBuffer
+ * @return 1 if the IOBuffer was full, otherwise 0
+ **/
+static inline int ARNETWORK_IOBuffer_ReleaseLockFreeCell(ARNETWORK_IOBuffer_t *IOBuffer)
 {
-    /** -- Pop the later data of the IOBuffer and free it -- */
+    return (__atomic_fetch_add(&(IOBuffer->lockFreeNumberOfFreeCells), 1, __ATOMIC_ACQ_REL) <= 0) ? 1 : 0;
+}
+
+/**
+ * @brief pop the canceled data at the front of the IOBuffer
+ * @details their callbacks were already called when they were canceled ; only their data copies are freed.
+ * @param IOBuffer The IOBuffer
+ **/
+static void ARNETWORK_IOBuffer_PopCanceledData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- pop the canceled data at the front of the IOBuffer -- */
 
     /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_DataDescriptor_t dataDescriptor;
 
-    /** pop and get the data descriptor */
-    error = ARNETWORK_RingBuffer_PopFront(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
-    if(error == ARNETWORK_OK)
+    while ((ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor) == ARNETWORK_OK) &&
+           (dataDescriptor.isCanceled))
     {
-        /** free data */
-        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
-    }
+        ARNETWORK_RingBuffer_PopFront(IOBuffer->dataDescriptorRBuffer, NULL);
+        ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
 
-    return error;
+        if ((IOBuffer->isLockFree) && (ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer)))
+        {
+            ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+        }
+    }
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_PopDataWithCallBack(ARNETWORK_IOBuffer_t *IOBuffer, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus)
+/**
+ * @brief pop all the data of an output buffer but its oldest data, borrowed by a reader
+ * @details the data are popped from the newest one, so that the borrowed data keeps its cell of the data copy.
+ * The data of an output buffer are copied by the receiver, without callback.
+ * @param IOBuffer The output buffer
+ **/
+static void ARNETWORK_IOBuffer_FlushAfterBorrowedData(ARNETWORK_IOBuffer_t *IOBuffer)
 {
-    /** -- Pop the later data of the IOBuffer with callback calling and free it -- */
+    /** -- pop the data added after the borrowed data -- */
 
     /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_DataDescriptor_t dataDescriptor;
 
-    /** pop and get the data descriptor */
-    error = ARNETWORK_RingBuffer_PopFront(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
-    if(error == ARNETWORK_OK)
+    while ((ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, 1) != NULL) &&
+           (ARNETWORK_RingBuffer_PopBack(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor) == ARNETWORK_OK))
     {
-        /** callback with the reason of the data popping */
-        if(dataDescriptor.callback != NULL)
+        if (dataDescriptor.isUsingDataCopy)
         {
-            dataDescriptor.callback(IOBuffer->ID, dataDescriptor.data, dataDescriptor.customData, callbackStatus);
+            ARNETWORK_RingBuffer_PopBack(IOBuffer->dataCopyRBuffer, NULL);
         }
-
-        /** free data */
-        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
     }
-
-    return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
+/**
+ * @brief Add the data described in a IOBuffer
+ * @param IOBuffer The input or output buffer
+ * @param dataDescriptor The data descriptor of the data to add
+ * @param[in] doDataCopy indocator to copy the data in the IOBuffer
+ * @param[in] segmentArr segments of the data to copy ; NULL to copy the data of the descriptor
+ * @param[in] numberOfSegments number of segments in segmentArr
+ * @return error eARNETWORK_ERROR
+ **/
+static eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataDescriptor(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_DataDescriptor_t *dataDescriptor, int doDataCopy, const struct iovec *segmentArr, int numberOfSegments)
 {
-    /** -- Flush the IoBuffer -- */
+    /** -- Add the data described in a IOBuffer -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    int numberOfFreeCell = 0;
+    struct iovec dataSegment;
 
-    /**  delete all data */
-    while(error == ARNETWORK_OK)
+    if (segmentArr == NULL)
     {
-        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        dataSegment.iov_base = dataDescriptor->data;
+        dataSegment.iov_len = dataDescriptor->dataSize;
+        segmentArr = &dataSegment;
+        numberOfSegments = 1;
     }
 
-    /** if the error occurred is "buffer empty" there is no error */
-    if(error == ARNETWORK_ERROR_BUFFER_EMPTY)
+    /** check the size of the copy before replacing or adding anything */
+    if ((doDataCopy) && ((!ARNETWORK_IOBuffer_CanCopyData(IOBuffer)) || (dataDescriptor->dataSize > IOBuffer->dataCopyRBuffer->cellSize)))
     {
-        error = ARNETWORK_OK;
+        return ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
-    /** state reset */
-    IOBuffer->isWaitAck = 0;
-    IOBuffer->alreadyHadData = 0;
-    IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeMs;
+    /** replace the data with the same key if any */
+    if ((dataDescriptor->hasKey) && (ARNETWORK_IOBuffer_CoalesceData(IOBuffer, dataDescriptor, doDataCopy, segmentArr, numberOfSegments)))
+    {
+        IOBuffer->alreadyHadData = 1;
+        return ARNETWORK_OK;
+    }
+
+    /** get the number of free cell */
+    numberOfFreeCell = ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer);
+
+    /** if the buffer is not full or it is overwriting */
+    if( (IOBuffer->dataDescriptorRBuffer->isOverwriting == 1) || (numberOfFreeCell > 0) )
+    {
+        /** if there is overwriting */
+        if ((numberOfFreeCell == 0) && (IOBuffer->isDataBorrowed))
+        {
+            /** the oldest data is borrowed by a reader: it can not be overwritten */
+            error = ARNETWORK_ERROR_BUFFER_FULL;
+        }
+        else if(numberOfFreeCell == 0)
+        {
+            /** if the buffer is full, cancel the data lost by the overwriting */
+            /** Delete the data Overwritten */
+            error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+        }
+
+        /** if data copy is asked */
+        if( (error == ARNETWORK_OK) && (doDataCopy) )
+        {
+            /** copy data in the dataCopyRBuffer and get the address of the data copy in descData */
+            error =  ARNETWORK_RingBuffer_PushBackSegments(IOBuffer->dataCopyRBuffer, segmentArr, numberOfSegments, &(dataDescriptor->data));
+
+            /** set the flag to indicate the copy of the data */
+            dataDescriptor->isUsingDataCopy = 1;
+        }
+
+        if(error == ARNETWORK_OK)
+        {
+            /** push dataDescriptor in the IOBuffer */
+            error = ARNETWORK_RingBuffer_PushBack(IOBuffer->dataDescriptorRBuffer, (uint8_t*) dataDescriptor);
+            IOBuffer->alreadyHadData = 1;
+        }
+
+        /** the writable eventfd of a lock-free IOBuffer is updated when its cells are taken */
+        if ((error == ARNETWORK_OK) && (!IOBuffer->isLockFree) && (ARNETWORK_IOBuffer_IsFull(IOBuffer)))
+        {
+            ARNETWORK_IOBuffer_UpdateWritableEventFd(IOBuffer);
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    return error;
+}
+
+/**
+ * @brief move the data added without lock at the end of the RingBuffers of the IOBuffer
+ * @details their cells are already taken: the RingBuffers have room for them.
+ * @param IOBuffer The lock-free IOBuffer, locked by the calling thread
+ **/
+static void ARNETWORK_IOBuffer_MoveLockFreeData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- move the data added without lock in the RingBuffers -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    uint8_t *cellData = NULL;
+    int doDataCopy = 0;
+
+    while ((cellData = ARNETWORK_LockFreeQueue_Front(IOBuffer->lockFreeQueue)) != NULL)
+    {
+        /** the data copy is stored after the data descriptor in the cell */
+        memcpy(&dataDescriptor, cellData, sizeof(ARNETWORK_DataDescriptor_t));
+        doDataCopy = dataDescriptor.isUsingDataCopy;
+        dataDescriptor.isUsingDataCopy = 0;
+        if (doDataCopy)
+        {
+            dataDescriptor.data = cellData + sizeof(ARNETWORK_DataDescriptor_t);
+        }
+
+        if (ARNETWORK_IOBuffer_AddDataDescriptor(IOBuffer, &dataDescriptor, doDataCopy, NULL, 0) != ARNETWORK_OK)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG, "[%d] Error: data added without lock lost", IOBuffer->ID);
+            if (ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer))
+            {
+                ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+            }
+        }
+
+        ARNETWORK_LockFreeQueue_PopFront(IOBuffer->lockFreeQueue);
+    }
+}
+
+/**
+ * @brief Add a data made of segments in a IOBuffer, to send at a given date
+ * @param IOBuffer The input or output buffer
+ * @param[in] segmentArr array of the segments of the data ; a data not copied must have only one segment
+ * @param[in] numberOfSegments number of segments in segmentArr
+ * @param[in] sendTime monotonic date before which the data is not sent ; NULL to send it as soon as possible
+ * @param[in] handle handle of the data, or 0
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the IOBuffer
+ * @param[in] buffer reference-counted buffer holding the data not copied, whose reference is given to the data ; NULL if none
+ * @return error eARNETWORK_ERROR
+ **/
+static eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataSegmentsAt(ARNETWORK_IOBuffer_t *IOBuffer, const struct iovec *segmentArr, int numberOfSegments, const struct timespec *sendTime, uint32_t handle, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, ARNETWORK_Buffer_t *buffer)
+{
+    /** -- Add a data made of segments in a IOBuffer, to send at a given date -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    size_t dataSize = 0;
+    int segmentIndex = 0;
+    size_t byteIndex = 0;
+    int keyByteCount = 0;
+
+    if ((numberOfSegments <= 0) || ((!doDataCopy) && (numberOfSegments != 1)))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    for (segmentIndex = 0; segmentIndex < numberOfSegments; ++segmentIndex)
+    {
+        dataSize += segmentArr[segmentIndex].iov_len;
+    }
+
+    /** the data added with lock to a lock-free IOBuffer take their cell as the others */
+    if ((IOBuffer->isLockFree) && (!ARNETWORK_IOBuffer_TakeLockFreeCell(IOBuffer, NULL)))
+    {
+        return ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    /** initialize dataDescriptor ; the data of a copy is set by the copy */
+    dataDescriptor.data = segmentArr[0].iov_base;
+    dataDescriptor.dataSize = dataSize;
+    dataDescriptor.customData = customData;
+    dataDescriptor.callback = callback;
+    dataDescriptor.isUsingDataCopy = 0;
+    dataDescriptor.hasKey = 0;
+    dataDescriptor.key = 0;
+    dataDescriptor.hasSendTime = (sendTime != NULL) ? 1 : 0;
+    if (sendTime != NULL)
+    {
+        dataDescriptor.sendTime = *sendTime;
+    }
+    dataDescriptor.handle = handle;
+    dataDescriptor.isCanceled = 0;
+    dataDescriptor.buffer = buffer;
+
+    /** the coalescing key is made of the first bytes of the data ; too short data are never coalesced */
+    if ((ARNETWORK_IOBuffer_IsCoalescing(IOBuffer)) && (dataSize >= (size_t)IOBuffer->coalescingKeySize))
+    {
+        for (segmentIndex = 0; keyByteCount < IOBuffer->coalescingKeySize; ++segmentIndex)
+        {
+            for (byteIndex = 0; (byteIndex < segmentArr[segmentIndex].iov_len) && (keyByteCount < IOBuffer->coalescingKeySize); ++byteIndex, ++keyByteCount)
+            {
+                dataDescriptor.key = (dataDescriptor.key << 8) | ((uint8_t *) segmentArr[segmentIndex].iov_base)[byteIndex];
+            }
+        }
+        dataDescriptor.hasKey = 1;
+    }
+
+    error = ARNETWORK_IOBuffer_AddDataDescriptor(IOBuffer, &dataDescriptor, doDataCopy, segmentArr, numberOfSegments);
+
+    if ((error != ARNETWORK_OK) && (IOBuffer->isLockFree) && (ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer)))
+    {
+        ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+    }
+
+    return error;
+}
+
+/**
+ * @brief get the size of the token bucket of the IOBuffer
+ * @param IOBuffer The IOBuffer
+ * @return size of the token bucket in token units ; never less than one rateLimitUnit
+ **/
+static inline int64_t ARNETWORK_IOBuffer_GetRateLimitBucketSize(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    int64_t burst = (IOBuffer->rateLimitBurst > 0) ? IOBuffer->rateLimitBurst : 1;
+    return burst * ARNETWORK_IOBUFFER_RATELIMIT_TOKEN_SCALE;
+}
+
+/**
+ * @brief get the cost of a frame in the token bucket of the IOBuffer
+ * @param IOBuffer The IOBuffer
+ * @param frameSize size of the frame in bytes
+ * @return cost of the frame in token units
+ **/
+static inline int64_t ARNETWORK_IOBuffer_GetRateLimitCost(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize)
+{
+    int64_t cost = (IOBuffer->rateLimitUnit == ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_FRAMES) ? 1 : frameSize;
+    return cost * ARNETWORK_IOBUFFER_RATELIMIT_TOKEN_SCALE;
+}
+
+/**
+ * @brief refill the token bucket of the IOBuffer according to the time elapsed since the last refill
+ * @param IOBuffer The IOBuffer
+ **/
+static void ARNETWORK_IOBuffer_RefillRateLimitTokens(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- refill the token bucket -- */
+
+    /** local declarations */
+    struct timespec now;
+    int64_t elapsedUs = 0;
+    int64_t bucketSize = ARNETWORK_IOBuffer_GetRateLimitBucketSize(IOBuffer);
+
+    ARSAL_Time_GetTime(&now);
+    elapsedUs = ((int64_t)(now.tv_sec - IOBuffer->rateLimitRefillTime.tv_sec) * 1000000) +
+        ((now.tv_nsec - IOBuffer->rateLimitRefillTime.tv_nsec) / 1000);
+
+    if (elapsedUs > 0)
+    {
+        if (elapsedUs > ARNETWORK_IOBUFFER_RATELIMIT_MAX_REFILL_US)
+        {
+            elapsedUs = ARNETWORK_IOBUFFER_RATELIMIT_MAX_REFILL_US;
+        }
+
+        /** rateLimit units per second is rateLimit token units per microsecond */
+        IOBuffer->rateLimitTokens += elapsedUs * IOBuffer->rateLimit;
+        if (IOBuffer->rateLimitTokens > bucketSize)
+        {
+            IOBuffer->rateLimitTokens = bucketSize;
+        }
+        IOBuffer->rateLimitRefillTime = now;
+    }
+}
+
+/**
+ * @brief add a time to a date
+ * @param date the date to update
+ * @param timeMs time to add in millisecond
+ **/
+static void ARNETWORK_IOBuffer_AddTimeMs(struct timespec *date, int timeMs)
+{
+    date->tv_sec += timeMs / 1000;
+    date->tv_nsec += (timeMs % 1000) * 1000000;
+    if (date->tv_nsec >= 1000000000)
+    {
+        date->tv_sec += 1;
+        date->tv_nsec -= 1000000000;
+    }
+}
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ ******************************************/
+
+ARNETWORK_IOBuffer_t* ARNETWORK_IOBuffer_New(const ARNETWORK_IOBufferParam_t *param, int isInternal)
+{
+    /** -- Create a new input or output buffer -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *IOBuffer = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int res = 0;
+
+    if (param == NULL)
+        return NULL;
+
+    /** Create the input or output buffer in accordance with parameters set in the ARNETWORK_IOBufferParam_t */
+    IOBuffer = calloc(1, sizeof(ARNETWORK_IOBuffer_t));
+    if (IOBuffer == NULL)
+        return NULL;
+
+    /** Initialize to default values */
+    IOBuffer->dataDescriptorRBuffer = NULL;
+    IOBuffer->dataCopyRBuffer = NULL;
+    IOBuffer->lockFreeQueue = NULL;
+    IOBuffer->writableWaitersCount = 0;
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+    IOBuffer->writableEventFd = -1;
+    IOBuffer->readableEventFd = -1;
+#endif
+    res = ARSAL_Mutex_Init(&(IOBuffer->mutex));
+    if (res != 0) {
+        error = ARNETWORK_ERROR_MUTEX;
+        goto error;
+    }
+    res = ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
+    if (res < 0) {
+        error = ARNETWORK_ERROR_SEMAPHORE;
+        goto error;
+    }
+    res = ARSAL_Cond_Init(&(IOBuffer->writableCond));
+    if (res != 0) {
+        error = ARNETWORK_ERROR_MUTEX;
+        goto error;
+    }
+
+    if (!isInternal) {
+        /** ARNETWORK_IOBufferParam_Check returns 1 if the parameters are correct, 0 otherwise */
+        res = ARNETWORK_IOBufferParam_Check(param);
+        if (res == 0) {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+            goto error;
+        }
+    }
+
+    IOBuffer->ID = param->ID;
+    IOBuffer->dataType = param->dataType;
+    IOBuffer->sendingWaitTimeMs = param->sendingWaitTimeMs;
+    IOBuffer->ackTimeoutMs = param->ackTimeoutMs;
+
+    if (param->numberOfRetry >= 0) {
+        IOBuffer->numberOfRetry = param->numberOfRetry;
+    } else {
+        /** if numberOfRetry equal 0 disable the retry function with -1 value */
+        IOBuffer->numberOfRetry = -1;
+    }
+
+    IOBuffer->coalescingKeySize = param->coalescingKeySize;
+    IOBuffer->rateLimit = param->rateLimit;
+    IOBuffer->rateLimitBurst = param->rateLimitBurst;
+    IOBuffer->rateLimitUnit = param->rateLimitUnit;
+    /** a zero-initialised sendBurstSize sends one data per pass, as the default */
+    IOBuffer->sendBurstSize = ((param->sendBurstSize > 0) || (param->sendBurstSize == ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER)) ? param->sendBurstSize : 1;
+    IOBuffer->overflowPolicy = param->overflowPolicy;
+    IOBuffer->alHeadroomSize = param->alHeadroomSize;
+    IOBuffer->isSendingInline = param->isSendingInline;
+    IOBuffer->senderLane = param->senderLane;
+    IOBuffer->receiverShard = param->receiverShard;
+    IOBuffer->isLockFree = param->isLockFree;
+    IOBuffer->lockFreeNumberOfFreeCells = param->numberOfCell;
+    IOBuffer->isFlowControlled = param->isFlowControlled;
+    IOBuffer->hasAdvertisedNoFreeCell = 0;
+
+    IOBuffer->isWaitAck = 0;
+    IOBuffer->seq = 0;
+    IOBuffer->alreadyHadData = 0;
+    IOBuffer->nbPackets = 0;
+    IOBuffer->nbNetwork = 0;
+    IOBuffer->nbOverflows = 0;
+    IOBuffer->nbDrops = 0;
+    IOBuffer->waitTimeCount = param->sendingWaitTimeMs;
+    IOBuffer->ackWaitTimeCount = param->ackTimeoutMs;
+    IOBuffer->retryCount = 0;
+    IOBuffer->flowControlWaitTimeCount = 0;
+    IOBuffer->rateLimitTokens = ARNETWORK_IOBuffer_GetRateLimitBucketSize(IOBuffer);
+    ARSAL_Time_GetTime(&(IOBuffer->rateLimitRefillTime));
+
+    IOBuffer->periodicData = NULL;
+    IOBuffer->periodicDataSize = 0;
+    IOBuffer->periodicDataCapacity = 0;
+    IOBuffer->periodicPeriodMs = 0;
+    IOBuffer->periodicUpdateCallback = NULL;
+    IOBuffer->periodicCustomData = NULL;
+    IOBuffer->dataHandleCount = 0;
+    IOBuffer->isDataBorrowed = 0;
+    IOBuffer->outputHandler = NULL;
+    IOBuffer->outputHandlerCustomData = NULL;
+    IOBuffer->isLatestOnly = param->isLatestOnly;
+    IOBuffer->latestData = NULL;
+    IOBuffer->latestDataCapacity = 0;
+    IOBuffer->latestDataSize = -1;
+    IOBuffer->latestSequence = 0;
+    IOBuffer->broadcastRing = NULL;
+
+    /** Create the RingBuffer for the information of the data*/
+    IOBuffer->dataDescriptorRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t), param->isOverwriting);
+    if (IOBuffer->dataDescriptorRBuffer == NULL) {
+        error = ARNETWORK_ERROR_NEW_RINGBUFFER;
+        goto error;
+    }
+
+    /** if the parameters have a size of data copy ; a latest-only or broadcast buffer stores its data in its own slot or ring */
+    if ((param->dataCopyMaxSize > 0) && (!param->isLatestOnly) && (param->maxNumberOfSubscribers <= 0)) {
+        /** Create the RingBuffer for the copy of the data*/
+        IOBuffer->dataCopyRBuffer = ARNETWORK_RingBuffer_NewWithOverwriting(param->numberOfCell, param->dataCopyMaxSize, param->isOverwriting);
+        if (IOBuffer->dataCopyRBuffer == NULL) {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+            goto error;
+        }
+    }
+
+    if ((IOBuffer->isLatestOnly) && (param->dataCopyMaxSize > 0)) {
+        /** Create the slot of the latest data received */
+        IOBuffer->latestData = malloc(param->dataCopyMaxSize);
+        if (IOBuffer->latestData == NULL) {
+            error = ARNETWORK_ERROR_ALLOC;
+            goto error;
+        }
+        IOBuffer->latestDataCapacity = param->dataCopyMaxSize;
+    }
+
+    if ((param->maxNumberOfSubscribers > 0) && (param->dataCopyMaxSize > 0)) {
+        /** Create the ring of the data read by the subscribers */
+        IOBuffer->broadcastRing = ARNETWORK_BroadcastRing_New(param->numberOfCell, param->dataCopyMaxSize, param->maxNumberOfSubscribers);
+        if (IOBuffer->broadcastRing == NULL) {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+            goto error;
+        }
+    }
+
+    if (IOBuffer->isLockFree) {
+        /** Create the queue of the data added without lock ; each cell holds a data descriptor followed by the data copy */
+        IOBuffer->lockFreeQueue = ARNETWORK_LockFreeQueue_New(param->numberOfCell, sizeof(ARNETWORK_DataDescriptor_t) + ((param->dataCopyMaxSize > 0) ? param->dataCopyMaxSize : 0));
+        if (IOBuffer->lockFreeQueue == NULL) {
+            error = ARNETWORK_ERROR_NEW_BUFFER;
+            goto error;
+        }
+    }
+
+    return IOBuffer;
+
+error:
+    /** delete the inOutput buffer if an error occurred */
+    ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG,"error: %s", ARNETWORK_Error_ToString (error));
+    ARNETWORK_IOBuffer_Delete(&IOBuffer);
+    return NULL;
+}
+
+void ARNETWORK_IOBuffer_Delete(ARNETWORK_IOBuffer_t **IOBuffer)
+{
+    /** -- Delete the input or output buffer -- */
+
+    /** local declarations */
+
+    if(IOBuffer != NULL)
+    {
+        if((*IOBuffer) != NULL)
+        {
+            /** the data added without lock are canceled with the other data */
+            if ((*IOBuffer)->lockFreeQueue != NULL)
+            {
+                ARNETWORK_IOBuffer_MoveLockFreeData((*IOBuffer));
+            }
+
+            /** the data are canceled before the destruction of the synchronization objects: popping them signals the writers */
+            /** the RingBuffers are not created if the creation of the IOBuffer failed before them */
+            if ((*IOBuffer)->dataDescriptorRBuffer != NULL)
+            {
+                ARNETWORK_IOBuffer_CancelAllData((*IOBuffer));
+            }
+
+            ARSAL_Mutex_Destroy(&((*IOBuffer)->mutex));
+            ARSAL_Sem_Destroy(&((*IOBuffer)->outputSem));
+            ARSAL_Cond_Destroy(&((*IOBuffer)->writableCond));
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+            if ((*IOBuffer)->writableEventFd >= 0)
+            {
+                close((*IOBuffer)->writableEventFd);
+                (*IOBuffer)->writableEventFd = -1;
+            }
+            if ((*IOBuffer)->readableEventFd >= 0)
+            {
+                close((*IOBuffer)->readableEventFd);
+                (*IOBuffer)->readableEventFd = -1;
+            }
+#endif
+
+            ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataDescriptorRBuffer));
+            ARNETWORK_RingBuffer_Delete(&((*IOBuffer)->dataCopyRBuffer));
+            ARNETWORK_LockFreeQueue_Delete(&((*IOBuffer)->lockFreeQueue));
+            free((*IOBuffer)->latestData);
+            ARNETWORK_BroadcastRing_Delete(&((*IOBuffer)->broadcastRing));
+
+            ARNETWORK_IOBuffer_StopPeriodicData((*IOBuffer));
+
+            free((*IOBuffer));
+            (*IOBuffer) = NULL;
+        }
+    }
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AckReceived(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t seqNumber)
+{
+    /** -- Receive an acknowledgement to a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    /** delete the data if the sequence number received is same as the sequence number expected */
+    if(IOBuffer->isWaitAck && IOBuffer->seq == seqNumber)
+    {
+        IOBuffer->isWaitAck = 0;
+        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_ACK_RECEIVED);
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_BAD_ACK;
+    }
+
+    return error;
+}
+
+int ARNETWORK_IOBuffer_IsWaitAck(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get if the IOBuffer is waiting an acknowledgement -- */
+
+    /** local declarations */
+    int isWaitAckCpy = 0;
+
+    isWaitAckCpy = IOBuffer->isWaitAck;
+
+    return isWaitAckCpy;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_Lock( ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Lock the IOBuffer's mutex -- **/
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int lockingReturn = 0;
+
+    /** lock the IOBuffer */
+    lockingReturn = ARSAL_Mutex_Lock(&(IOBuffer->mutex));
+
+    if(lockingReturn != 0)
+    {
+        switch(lockingReturn)
+        {
+        case EDEADLK:
+            error = ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK;
+            break;
+
+        default:
+            error = ARNETWORK_ERROR_MUTEX;
+            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_IOBUFFER_TAG, "locking return : %d unexpected", lockingReturn);
+            break;
+        }
+    }
+    else if (IOBuffer->lockFreeQueue != NULL)
+    {
+        /** the data added without lock join the other data */
+        ARNETWORK_IOBuffer_MoveLockFreeData(IOBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_Unlock( ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Unlock the IOBuffer's mutex -- **/
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int unlockingReturn = 0;
+
+    /** unlock the IOBuffer if there is not correctly unlocked */
+    unlockingReturn = ARSAL_Mutex_Unlock(&(IOBuffer->mutex));
+
+    if(unlockingReturn != 0)
+    {
+        switch(unlockingReturn)
+        {
+        case EDEADLK:
+            error = ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK;
+            break;
+
+        default:
+            error = ARNETWORK_ERROR_MUTEX;
+            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_IOBUFFER_TAG, "unlocking return : %d unexpected", unlockingReturn);
+            break;
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_CancelAllData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- cancel all remaining data -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORK_ERROR deleteError = ARNETWORK_OK;
+
+    /** pop all data with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status */
+    while(deleteError == ARNETWORK_OK)
+    {
+        deleteError = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+    }
+
+    if(deleteError != ARNETWORK_ERROR_BUFFER_EMPTY)
+    {
+        error = deleteError;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PopData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Pop the later data of the IOBuffer and free it -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    int wasFull = ARNETWORK_IOBuffer_IsFull(IOBuffer);
+
+    /** pop and get the data descriptor */
+    error = ARNETWORK_RingBuffer_PopFront(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    if(error == ARNETWORK_OK)
+    {
+        /** free data */
+        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
+
+        if (IOBuffer->isLockFree)
+        {
+            wasFull = ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer);
+        }
+
+        /** the next data can not be a canceled one */
+        ARNETWORK_IOBuffer_PopCanceledData(IOBuffer);
+
+        if (wasFull)
+        {
+            ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_PopDataWithCallBack(ARNETWORK_IOBuffer_t *IOBuffer, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus)
+{
+    /** -- Pop the later data of the IOBuffer with callback calling and free it -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    int wasFull = ARNETWORK_IOBuffer_IsFull(IOBuffer);
+
+    /** pop and get the data descriptor */
+    error = ARNETWORK_RingBuffer_PopFront(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    if(error == ARNETWORK_OK)
+    {
+        /** callback with the reason of the data popping */
+        if(dataDescriptor.callback != NULL)
+        {
+            dataDescriptor.callback(IOBuffer->ID, dataDescriptor.data, dataDescriptor.customData, callbackStatus);
+        }
+
+        /** free data */
+        error = ARNETWORK_IOBuffer_FreeData(IOBuffer, &dataDescriptor);
+
+        if (IOBuffer->isLockFree)
+        {
+            wasFull = ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer);
+        }
+
+        /** the next data can not be a canceled one */
+        ARNETWORK_IOBuffer_PopCanceledData(IOBuffer);
+
+        if (wasFull)
+        {
+            ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Flush the IoBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    /**  delete all data */
+    if (IOBuffer->isDataBorrowed)
+    {
+        /** the borrowed data is popped when it is released */
+        ARNETWORK_IOBuffer_FlushAfterBorrowedData(IOBuffer);
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+    while(error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+    }
+
+    /** if the error occurred is "buffer empty" there is no error */
+    if(error == ARNETWORK_ERROR_BUFFER_EMPTY)
+    {
+        error = ARNETWORK_OK;
+    }
+
+    /** state reset */
+    IOBuffer->isWaitAck = 0;
+    IOBuffer->alreadyHadData = 0;
+    IOBuffer->waitTimeCount = IOBuffer->sendingWaitTimeMs;
     IOBuffer->ackWaitTimeCount = IOBuffer->ackTimeoutMs;
     IOBuffer->retryCount = 0;
+    IOBuffer->flowControlWaitTimeCount = 0;
+    IOBuffer->rateLimitTokens = ARNETWORK_IOBuffer_GetRateLimitBucketSize(IOBuffer);
+    ARSAL_Time_GetTime(&(IOBuffer->rateLimitRefillTime));
+
+    if (IOBuffer->latestData != NULL)
+    {
+        ARNETWORK_IOBuffer_SetLatestData(IOBuffer, NULL, -1);
+    }
+
+    if (IOBuffer->broadcastRing != NULL)
+    {
+        ARNETWORK_BroadcastRing_Clean(IOBuffer->broadcastRing);
+    }
+
+    /** reset semaphore */
+    ARSAL_Sem_Destroy(&(IOBuffer->outputSem));
+    ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
+
+    if (ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer))
+    {
+        ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data in a IOBuffer -- */
+    return ARNETWORK_IOBuffer_AddDataAt(IOBuffer, data, dataSize, NULL, 0, customData, callback, doDataCopy);
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataAt(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, const struct timespec *sendTime, uint32_t handle, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data in a IOBuffer, to send at a given date -- */
+
+    /** local declarations */
+    struct iovec dataSegment;
+
+    dataSegment.iov_base = data;
+    dataSegment.iov_len = dataSize;
+
+    return ARNETWORK_IOBuffer_AddDataSegmentsAt(IOBuffer, &dataSegment, 1, sendTime, handle, customData, callback, doDataCopy, NULL);
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataSegments(ARNETWORK_IOBuffer_t *IOBuffer, const struct iovec *segmentArr, int numberOfSegments, void *customData, ARNETWORK_Manager_Callback_t callback)
+{
+    /** -- Add the copy of a data made of several segments in a IOBuffer -- */
+    return ARNETWORK_IOBuffer_AddDataSegmentsAt(IOBuffer, segmentArr, numberOfSegments, NULL, 0, customData, callback, 1, NULL);
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddBuffer(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_Buffer_t *buffer, void *customData, ARNETWORK_Manager_Callback_t callback)
+{
+    /** -- Add the data of a reference-counted buffer in a IOBuffer, without copy -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    struct iovec dataSegment;
+
+    dataSegment.iov_base = ARNETWORK_Buffer_GetData(buffer);
+    dataSegment.iov_len = ARNETWORK_Buffer_GetSize(buffer);
+
+    /** the reference of the IOBuffer is released when the data is freed */
+    ARNETWORK_Buffer_Ref(buffer);
+    error = ARNETWORK_IOBuffer_AddDataSegmentsAt(IOBuffer, &dataSegment, 1, NULL, 0, customData, callback, 0, buffer);
+    if (error != ARNETWORK_OK)
+    {
+        ARNETWORK_Buffer_Unref(buffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataLockFree(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int *wasEmptyPtr)
+{
+    /** -- Add data in a lock-free IOBuffer without locking it -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    uint8_t *cellData = NULL;
+    uint32_t position = 0;
+    int wasEmpty = 0;
+
+    /** check the size of the copy as the RingBuffers of the IOBuffer will get it */
+    if ((doDataCopy) && ((!ARNETWORK_IOBuffer_CanCopyData(IOBuffer)) || (dataSize > IOBuffer->dataCopyRBuffer->cellSize)))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (!ARNETWORK_IOBuffer_TakeLockFreeCell(IOBuffer, &wasEmpty))
+    {
+        return ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    cellData = ARNETWORK_LockFreeQueue_ReserveBack(IOBuffer->lockFreeQueue, &position);
+    if (cellData == NULL)
+    {
+        /** the queue has at least as many cells as the IOBuffer, it should never be full */
+        if (ARNETWORK_IOBuffer_ReleaseLockFreeCell(IOBuffer))
+        {
+            ARNETWORK_IOBuffer_UpdateWritableEventFd(IOBuffer);
+        }
+        return ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    /** initialize dataDescriptor */
+    dataDescriptor.data = data;
+    dataDescriptor.dataSize = dataSize;
+    dataDescriptor.customData = customData;
+    dataDescriptor.callback = callback;
+    dataDescriptor.isUsingDataCopy = 0;
+    dataDescriptor.hasKey = 0;
+    dataDescriptor.key = 0;
+    dataDescriptor.hasSendTime = 0;
+    dataDescriptor.handle = 0;
+    dataDescriptor.isCanceled = 0;
+    dataDescriptor.buffer = NULL;
+
+    /** the data copy follows the data descriptor in the cell ; isUsingDataCopy marks it until the data is moved */
+    if (doDataCopy)
+    {
+        memcpy(cellData + sizeof(ARNETWORK_DataDescriptor_t), data, dataSize);
+        dataDescriptor.data = NULL;
+        dataDescriptor.isUsingDataCopy = 1;
+    }
+    memcpy(cellData, &dataDescriptor, sizeof(ARNETWORK_DataDescriptor_t));
+
+    ARNETWORK_LockFreeQueue_CommitBack(IOBuffer->lockFreeQueue, position);
+
+    if (wasEmptyPtr != NULL)
+    {
+        *wasEmptyPtr = wasEmpty;
+    }
+
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataWithKey(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, uint32_t key, uint32_t handle, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data in a IOBuffer with an explicit coalescing key -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+
+    if (!ARNETWORK_IOBuffer_IsCoalescing(IOBuffer))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** initialize dataDescriptor */
+    dataDescriptor.data = data;
+    dataDescriptor.dataSize = dataSize;
+    dataDescriptor.customData = customData;
+    dataDescriptor.callback = callback;
+    dataDescriptor.isUsingDataCopy = 0;
+    dataDescriptor.hasKey = 1;
+    dataDescriptor.key = key;
+    dataDescriptor.hasSendTime = 0;
+    dataDescriptor.handle = handle;
+    dataDescriptor.isCanceled = 0;
+    dataDescriptor.buffer = NULL;
+
+    return ARNETWORK_IOBuffer_AddDataDescriptor(IOBuffer, &dataDescriptor, doDataCopy, NULL, 0);
+}
+
+uint32_t ARNETWORK_IOBuffer_NewDataHandle(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get a new data handle of the IOBuffer -- */
+
+    /** the count is stored above the identifier of the IOBuffer ; 0 is never a handle */
+    IOBuffer->dataHandleCount = (IOBuffer->dataHandleCount + 1) & 0xFFFFFF;
+    if (IOBuffer->dataHandleCount == 0)
+    {
+        IOBuffer->dataHandleCount = 1;
+    }
+
+    return (IOBuffer->dataHandleCount << 8) | (uint32_t)(IOBuffer->ID & 0xFF);
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_CancelData(ARNETWORK_IOBuffer_t *IOBuffer, uint32_t handle)
+{
+    /** -- Cancel a data of the IOBuffer -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t *dataDescriptor = NULL;
+    unsigned int dataIndex = 0;
+
+    dataDescriptor = ARNETWORK_IOBuffer_FindData(IOBuffer, handle, &dataIndex);
+    if (dataDescriptor == NULL)
+    {
+        return ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND;
+    }
+
+    if (dataIndex == 0)
+    {
+        /** the front data is popped now ; if it was waiting its acknowledgement, it will not be sent again */
+        IOBuffer->isWaitAck = 0;
+        return ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+    }
+
+    /** a data behind other data keeps its cell, and its data copy, until it reaches the front */
+    if (dataDescriptor->callback != NULL)
+    {
+        dataDescriptor->callback(IOBuffer->ID, dataDescriptor->data, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+
+        if (!dataDescriptor->isUsingDataCopy)
+        {
+            dataDescriptor->callback(IOBuffer->ID, dataDescriptor->data, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
+        }
+
+        dataDescriptor->callback(IOBuffer->ID, NULL, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
+    }
+
+    dataDescriptor->isCanceled = 1;
+    dataDescriptor->callback = NULL;
+    dataDescriptor->hasKey = 0;
+    dataDescriptor->hasSendTime = 0;
+
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReplaceData(ARNETWORK_IOBuffer_t *IOBuffer, uint32_t handle, uint8_t *data, size_t dataSize)
+{
+    /** -- Replace in place the content of a data of the IOBuffer -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t *dataDescriptor = NULL;
+    unsigned int dataIndex = 0;
+    uint8_t *previousData = NULL;
+
+    dataDescriptor = ARNETWORK_IOBuffer_FindData(IOBuffer, handle, &dataIndex);
+    if (dataDescriptor == NULL)
+    {
+        return ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND;
+    }
+
+    if (dataDescriptor->isUsingDataCopy)
+    {
+        /** the new content takes the cell of the data copy */
+        if (dataSize > IOBuffer->dataCopyRBuffer->cellSize)
+        {
+            return ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+        memcpy(dataDescriptor->data, data, dataSize);
+        dataDescriptor->dataSize = dataSize;
+    }
+    else
+    {
+        /** keep the new pointer and give back the previous one */
+        previousData = dataDescriptor->data;
+        dataDescriptor->data = data;
+        dataDescriptor->dataSize = dataSize;
+
+        if ((dataDescriptor->callback != NULL) && (previousData != data))
+        {
+            dataDescriptor->callback(IOBuffer->ID, previousData, dataDescriptor->customData, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
+        }
+    }
+
+    /** the content waiting its acknowledgement is outdated: the new content is sent as a new data, with a new sequence number */
+    if (dataIndex == 0)
+    {
+        IOBuffer->isWaitAck = 0;
+    }
+
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WaitWritable(ARNETWORK_IOBuffer_t *IOBuffer, int timeoutMs)
+{
+    /** -- Wait for a free cell in a full IOBuffer -- */
+
+    if ((ARNETWORK_IOBuffer_IsFull(IOBuffer)) && (timeoutMs > 0))
+    {
+        /** the data popped by the sender signal the condition only when a producer waits */
+        IOBuffer->writableWaitersCount++;
+        ARSAL_Cond_Timedwait(&(IOBuffer->writableCond), &(IOBuffer->mutex), timeoutMs);
+        IOBuffer->writableWaitersCount--;
+    }
+
+    return (ARNETWORK_IOBuffer_IsFull(IOBuffer)) ? ARNETWORK_ERROR_BUFFER_SIZE : ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_GetWritableEventFd(ARNETWORK_IOBuffer_t *IOBuffer, int *fd)
+{
+    /** -- Get the eventfd readable while the IOBuffer is not full -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+    int eventFd = -1;
+
+    if (IOBuffer->writableEventFd < 0)
+    {
+        eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (eventFd < 0)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG, "[%d] Error: can't create the writable eventfd %s", IOBuffer->ID, strerror(errno));
+            error = ARNETWORK_ERROR_IOBUFFER;
+        }
+        else
+        {
+            /** the producers of a lock-free IOBuffer update the eventfd as soon as it is published */
+            __atomic_store_n(&(IOBuffer->writableEventFd), eventFd, __ATOMIC_RELEASE);
+            ARNETWORK_IOBuffer_UpdateWritableEventFd(IOBuffer);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        *fd = IOBuffer->writableEventFd;
+    }
+#else
+    (void) IOBuffer;
+    (void) fd;
+    error = ARNETWORK_ERROR_IOBUFFER;
+#endif
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_GetReadableEventFd(ARNETWORK_IOBuffer_t *IOBuffer, int *fd)
+{
+    /** -- Get the eventfd readable while the IOBuffer is not empty -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+    if (IOBuffer->readableEventFd < 0)
+    {
+        IOBuffer->readableEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (IOBuffer->readableEventFd < 0)
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG, "[%d] Error: can't create the readable eventfd %s", IOBuffer->ID, strerror(errno));
+            error = ARNETWORK_ERROR_IOBUFFER;
+        }
+        else if (!ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer))
+        {
+            ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        *fd = IOBuffer->readableEventFd;
+    }
+#else
+    (void) IOBuffer;
+    (void) fd;
+    error = ARNETWORK_ERROR_IOBUFFER;
+#endif
+
+    return error;
+}
+
+void ARNETWORK_IOBuffer_UpdateReadableEventFd(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Update the readable eventfd of the IOBuffer -- */
+
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+    /** local declarations */
+    uint64_t value = 1;
+    int ret = 0;
+
+    if (IOBuffer->readableEventFd >= 0)
+    {
+        do
+        {
+            value = 1;
+            ret = (ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer)) ?
+                read(IOBuffer->readableEventFd, &value, sizeof(value)) :
+                write(IOBuffer->readableEventFd, &value, sizeof(value));
+        } while ((ret < 0) && (errno == EINTR));
+
+        /** reading an eventfd already at 0 fails with EAGAIN, which is expected */
+        if ((ret < 0) && (errno != EAGAIN))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_IOBUFFER_TAG, "[%d] Error: can't update the readable eventfd %s", IOBuffer->ID, strerror(errno));
+        }
+    }
+#else
+    (void) IOBuffer;
+#endif
+}
+
+int ARNETWORK_IOBuffer_GetNumberOfData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get the number of data waiting to be sent in the IOBuffer -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t *dataDescriptor = NULL;
+    unsigned int dataIndex = 0;
+    int numberOfData = 0;
+
+    for (dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, dataIndex);
+         dataDescriptor != NULL;
+         dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, ++dataIndex))
+    {
+        if (!dataDescriptor->isCanceled)
+        {
+            numberOfData++;
+        }
+    }
+
+    return numberOfData;
+}
+
+int ARNETWORK_IOBuffer_GetEstimatedDrainTimeMs(ARNETWORK_IOBuffer_t *IOBuffer, int roundTripTimeMs)
+{
+    /** -- Estimate the time needed by the sender to send all the data of the IOBuffer -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t *dataDescriptor = NULL;
+    unsigned int dataIndex = 0;
+    int numberOfData = 0;
+    int64_t rateLimitCost = 0;
+    int64_t missingTokens = 0;
+    int numberOfPasses = 0;
+    int passTimeMs = 0;
+    int64_t drainTimeMs = 0;
+    int64_t rateLimitTimeMs = 0;
+
+    for (dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, dataIndex);
+         dataDescriptor != NULL;
+         dataDescriptor = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, ++dataIndex))
+    {
+        if (!dataDescriptor->isCanceled)
+        {
+            numberOfData++;
+            rateLimitCost += ARNETWORK_IOBuffer_GetRateLimitCost(IOBuffer, offsetof(ARNETWORKAL_Frame_t, dataPtr) + dataDescriptor->dataSize);
+        }
+    }
+
+    if (numberOfData == 0)
+    {
+        return 0;
+    }
+
+    if (IOBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+    {
+        /** a data with ack is sent only after the acknowledgement of the previous one */
+        numberOfPasses = numberOfData;
+        passTimeMs = (roundTripTimeMs > IOBuffer->sendingWaitTimeMs) ? roundTripTimeMs : IOBuffer->sendingWaitTimeMs;
+    }
+    else
+    {
+        numberOfPasses = (IOBuffer->sendBurstSize > 0) ? ((numberOfData + IOBuffer->sendBurstSize - 1) / IOBuffer->sendBurstSize) : 1;
+        passTimeMs = IOBuffer->sendingWaitTimeMs;
+    }
+
+    /** the first pass is done at the end of the current wait */
+    drainTimeMs = (int64_t)(numberOfPasses - 1) * passTimeMs;
+    if (IOBuffer->waitTimeCount > 0)
+    {
+        drainTimeMs += IOBuffer->waitTimeCount;
+    }
+
+    /** the token bucket can be slower than the passes of the sender */
+    if (ARNETWORK_IOBuffer_IsRateLimited(IOBuffer))
+    {
+        ARNETWORK_IOBuffer_RefillRateLimitTokens(IOBuffer);
+        missingTokens = rateLimitCost - IOBuffer->rateLimitTokens;
+        if (missingTokens > 0)
+        {
+            /** rateLimit token units per microsecond */
+            rateLimitTimeMs = (missingTokens + ((int64_t)IOBuffer->rateLimit * 1000) - 1) / ((int64_t)IOBuffer->rateLimit * 1000);
+            if (rateLimitTimeMs > drainTimeMs)
+            {
+                drainTimeMs = rateLimitTimeMs;
+            }
+        }
+    }
+
+    return (drainTimeMs < INT32_MAX) ? (int)drainTimeMs : INT32_MAX;
+}
+
+int ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize)
+{
+    /** -- Get the time to wait before the token bucket allows to send a frame -- */
+
+    /** local declarations */
+    int64_t cost = ARNETWORK_IOBuffer_GetRateLimitCost(IOBuffer, frameSize);
+    int64_t bucketSize = ARNETWORK_IOBuffer_GetRateLimitBucketSize(IOBuffer);
+    int64_t missingTokens = 0;
+    int64_t waitTimeUs = 0;
+
+    if (!ARNETWORK_IOBuffer_IsRateLimited(IOBuffer))
+    {
+        return 0;
+    }
+
+    ARNETWORK_IOBuffer_RefillRateLimitTokens(IOBuffer);
+
+    /** a frame larger than the bucket only waits for a full bucket */
+    if (cost > bucketSize)
+    {
+        cost = bucketSize;
+    }
 
-    /** reset semaphore */
-    ARSAL_Sem_Destroy(&(IOBuffer->outputSem));
-    ARSAL_Sem_Init(&(IOBuffer->outputSem), 0, 0);
+    missingTokens = cost - IOBuffer->rateLimitTokens;
+    if (missingTokens <= 0)
+    {
+        return 0;
+    }
 
-    return error;
+    /** round up to the next millisecond, the caller must not wake up before the tokens are available */
+    waitTimeUs = (missingTokens + IOBuffer->rateLimit - 1) / IOBuffer->rateLimit;
+    return (int)((waitTimeUs + 999) / 1000);
 }
 
-eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+void ARNETWORK_IOBuffer_ConsumeRateLimitTokens(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize)
 {
-    /** -- Add data in a IOBuffer -- */
+    /** -- Remove the tokens of a frame sent from the token bucket -- */
 
-    /** local declarations */
-    eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_DataDescriptor_t dataDescriptor;
-    int numberOfFreeCell = 0;
+    if (ARNETWORK_IOBuffer_IsRateLimited(IOBuffer))
+    {
+        /** the bucket can become negative: the debt is paid back before the next sending */
+        IOBuffer->rateLimitTokens -= ARNETWORK_IOBuffer_GetRateLimitCost(IOBuffer, frameSize);
+    }
+}
 
-    /** initialize dataDescriptor */
-    dataDescriptor.data = data;
-    dataDescriptor.dataSize = dataSize;
-    dataDescriptor.customData = customData;
-    dataDescriptor.callback = callback;
-    dataDescriptor.isUsingDataCopy = 0;
+void ARNETWORK_IOBuffer_RefundRateLimitTokens(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize)
+{
+    /** -- Give back to the token bucket the tokens of a frame finally not sent -- */
 
-    /** get the number of free cell */
-    numberOfFreeCell = ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer);
+    /** local declarations */
+    int64_t bucketSize = ARNETWORK_IOBuffer_GetRateLimitBucketSize(IOBuffer);
 
-    /** if the buffer is not full or it is overwriting */
-    if( (IOBuffer->dataDescriptorRBuffer->isOverwriting == 1) || (numberOfFreeCell > 0) )
+    if (ARNETWORK_IOBuffer_IsRateLimited(IOBuffer))
     {
-        /** if there is overwriting */
-        if(numberOfFreeCell == 0)
+        IOBuffer->rateLimitTokens += ARNETWORK_IOBuffer_GetRateLimitCost(IOBuffer, frameSize);
+        if (IOBuffer->rateLimitTokens > bucketSize)
         {
-            /** if the buffer is full, cancel the data lost by the overwriting */
-            /** Delete the data Overwritten */
-            error = ARNETWORK_IOBuffer_PopDataWithCallBack(IOBuffer, ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL);
+            IOBuffer->rateLimitTokens = bucketSize;
         }
+    }
+}
 
-        /** if data copy is asked */
-        if( (error == ARNETWORK_OK) && (doDataCopy) )
-        {
-            /** check if the IOBuffer can copy and if the size of the copy buffer is large enough */
-            if( (ARNETWORK_IOBuffer_CanCopyData(IOBuffer)) && (dataSize <= IOBuffer->dataCopyRBuffer->cellSize) )
-            {
-                /** copy data in the dataCopyRBuffer and get the address of the data copy in descData */
-                error =  ARNETWORK_RingBuffer_PushBackWithSize(IOBuffer->dataCopyRBuffer, data, dataSize, &(dataDescriptor.data));
+eARNETWORK_ERROR ARNETWORK_IOBuffer_StartPeriodicData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize, int maxDataSize, int periodMs, ARNETWORK_Manager_PeriodicDataUpdate_t updateCallback, void *customData)
+{
+    /** -- Start to send a data periodically in the IOBuffer -- */
 
-                /** set the flag to indicate the copy of the data */
-                dataDescriptor.isUsingDataCopy = 1;
-            }
-            else
-            {
-                error = ARNETWORK_ERROR_BAD_PARAMETER;
-            }
-        }
+    /** local declarations */
+    int capacity = dataSize;
+    uint8_t *slot = NULL;
 
-        if(error == ARNETWORK_OK)
+    if (dataSize > maxDataSize)
+    {
+        return ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    /** the slot can hold the largest data accepted by the IOBuffer, so that the updates can change the size of the data, but not more than a frame of ARNetworkAL */
+    if ((IOBuffer->dataCopyRBuffer != NULL) && (IOBuffer->dataCopyRBuffer->cellSize > (unsigned int)capacity))
+    {
+        capacity = IOBuffer->dataCopyRBuffer->cellSize;
+    }
+    if (capacity > maxDataSize)
+    {
+        capacity = maxDataSize;
+    }
+
+    if (capacity != IOBuffer->periodicDataCapacity)
+    {
+        slot = realloc(IOBuffer->periodicData, capacity);
+        if (slot == NULL)
         {
-            /** push dataDescriptor in the IOBuffer */
-            error = ARNETWORK_RingBuffer_PushBack(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
-            IOBuffer->alreadyHadData = 1;
+            return ARNETWORK_ERROR_ALLOC;
         }
+        IOBuffer->periodicData = slot;
+        IOBuffer->periodicDataCapacity = capacity;
     }
-    else
+
+    memcpy(IOBuffer->periodicData, data, dataSize);
+    IOBuffer->periodicDataSize = dataSize;
+    IOBuffer->periodicPeriodMs = periodMs;
+    IOBuffer->periodicUpdateCallback = updateCallback;
+    IOBuffer->periodicCustomData = customData;
+    ARSAL_Time_GetTime(&(IOBuffer->periodicNextTime));
+
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_UpdatePeriodicData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize)
+{
+    /** -- Update the periodic data of the IOBuffer -- */
+
+    if (!ARNETWORK_IOBuffer_IsPeriodic(IOBuffer))
     {
-        error = ARNETWORK_ERROR_BUFFER_SIZE;
+        return ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
-    return error;
+    if (dataSize > IOBuffer->periodicDataCapacity)
+    {
+        return ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+
+    memcpy(IOBuffer->periodicData, data, dataSize);
+    IOBuffer->periodicDataSize = dataSize;
+
+    return ARNETWORK_OK;
+}
+
+void ARNETWORK_IOBuffer_StopPeriodicData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Stop to send the periodic data of the IOBuffer -- */
+
+    free(IOBuffer->periodicData);
+    IOBuffer->periodicData = NULL;
+    IOBuffer->periodicDataSize = 0;
+    IOBuffer->periodicDataCapacity = 0;
+    IOBuffer->periodicUpdateCallback = NULL;
+    IOBuffer->periodicCustomData = NULL;
+}
+
+int ARNETWORK_IOBuffer_GetPeriodicWaitTimeMs(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Get the time to wait before the next sending of the periodic data -- */
+
+    /** local declarations */
+    struct timespec now;
+    int64_t remainingTimeUs = 0;
+
+    ARSAL_Time_GetTime(&now);
+    remainingTimeUs = ((int64_t)(IOBuffer->periodicNextTime.tv_sec - now.tv_sec) * 1000000) +
+        ((IOBuffer->periodicNextTime.tv_nsec - now.tv_nsec) / 1000);
+
+    if (remainingTimeUs <= 0)
+    {
+        return 0;
+    }
+
+    /** round up to the next millisecond, the caller must not wake up before the sending date */
+    return (int)((remainingTimeUs + 999) / 1000);
+}
+
+void ARNETWORK_IOBuffer_SchedulePeriodicData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- Schedule the next sending of the periodic data -- */
+
+    /** the date is computed from the previous date, not from the sending date, to avoid a drift of the period */
+    ARNETWORK_IOBuffer_AddTimeMs(&(IOBuffer->periodicNextTime), IOBuffer->periodicPeriodMs);
+
+    /** skip the periods missed */
+    if (ARNETWORK_IOBuffer_GetPeriodicWaitTimeMs(IOBuffer) == 0)
+    {
+        ARSAL_Time_GetTime(&(IOBuffer->periodicNextTime));
+        ARNETWORK_IOBuffer_AddTimeMs(&(IOBuffer->periodicNextTime), IOBuffer->periodicPeriodMs);
+    }
 }
 
 int ARNETWORK_IOBuffer_ShouldAcceptData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t seqnum)
@@ -506,8 +1804,16 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
     ARNETWORK_DataDescriptor_t dataDescriptor;
     int localReadSize = 0;
 
-    /** get data descriptor*/
-    error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    /** the oldest data can not be read while it is borrowed */
+    if (IOBuffer->isDataBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+    else
+    {
+        /** get data descriptor*/
+        error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    }
 
     if( error == ARNETWORK_OK )
     {
@@ -522,6 +1828,11 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
 
             /** pop the data */
             ARNETWORK_IOBuffer_PopData(IOBuffer);
+
+            if (ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer))
+            {
+                ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+            }
         }
         else
         {
@@ -538,6 +1849,273 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uin
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadDataBatch(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, ARNETWORK_Manager_ReadSlice_t *sliceArr, int maxNumberOfSlices, int *numberOfSlicesPtr)
+{
+    /** -- read several data received in a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptorArr[ARNETWORK_IOBUFFER_READBATCH_CHUNK_SIZE];
+    size_t offset = 0;
+    int numberOfSlices = 0;
+    int numberOfDataAsked = 0;
+    int numberOfDataFront = 0;
+    int numberOfDataRead = 0;
+    int wasFull = ARNETWORK_IOBuffer_IsFull(IOBuffer);
+
+    /** the oldest data can not be read while it is borrowed */
+    if (IOBuffer->isDataBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+
+    /** the data descriptors are copied by chunks, each one in one lock of the RingBuffer */
+    while ((error == ARNETWORK_OK) && (numberOfSlices < maxNumberOfSlices))
+    {
+        numberOfDataAsked = maxNumberOfSlices - numberOfSlices;
+        if (numberOfDataAsked > ARNETWORK_IOBUFFER_READBATCH_CHUNK_SIZE)
+        {
+            numberOfDataAsked = ARNETWORK_IOBUFFER_READBATCH_CHUNK_SIZE;
+        }
+        numberOfDataFront = ARNETWORK_RingBuffer_FrontN(IOBuffer->dataDescriptorRBuffer, (uint8_t*) dataDescriptorArr, numberOfDataAsked);
+
+        for (numberOfDataRead = 0; numberOfDataRead < numberOfDataFront; ++numberOfDataRead)
+        {
+            if (dataDescriptorArr[numberOfDataRead].dataSize <= (dataLimitSize - offset))
+            {
+                memcpy(data + offset, dataDescriptorArr[numberOfDataRead].data, dataDescriptorArr[numberOfDataRead].dataSize);
+                sliceArr[numberOfSlices].dataPtr = data + offset;
+                sliceArr[numberOfSlices].dataSize = dataDescriptorArr[numberOfDataRead].dataSize;
+                offset += dataDescriptorArr[numberOfDataRead].dataSize;
+                numberOfSlices++;
+            }
+            else
+            {
+                error = ARNETWORK_ERROR_BUFFER_SIZE;
+                break;
+            }
+        }
+
+        /** the data of an output buffer are all copies: the data read and their copies are popped by moving the output indexes */
+        if (numberOfDataRead > 0)
+        {
+            ARNETWORK_RingBuffer_DiscardFront(IOBuffer->dataDescriptorRBuffer, numberOfDataRead);
+            if (IOBuffer->dataCopyRBuffer != NULL)
+            {
+                ARNETWORK_RingBuffer_DiscardFront(IOBuffer->dataCopyRBuffer, numberOfDataRead);
+            }
+        }
+
+        if ((error == ARNETWORK_OK) && (numberOfDataFront < numberOfDataAsked))
+        {
+            error = ARNETWORK_ERROR_BUFFER_EMPTY;
+        }
+    }
+
+    if (numberOfSlices > 0)
+    {
+        if (wasFull)
+        {
+            ARNETWORK_IOBuffer_NotifyWritable(IOBuffer);
+        }
+        if (ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer))
+        {
+            ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+        }
+
+        /** the end of the data, or a data which does not fit, only ends the batch */
+        error = ARNETWORK_OK;
+    }
+
+    *numberOfSlicesPtr = numberOfSlices;
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadNewestData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, int *readSize, int *numberOfDataPoppedPtr)
+{
+    /** -- read the newest data received in a IOBuffer and pop the older ones -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    uint8_t *newestDataDescriptorPtr = NULL;
+    int numberOfData = 0;
+    int localReadSize = 0;
+
+    numberOfData = IOBuffer->dataDescriptorRBuffer->numberOfCell - ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer);
+
+    if (IOBuffer->isDataBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+    else if (numberOfData == 0)
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+    else
+    {
+        newestDataDescriptorPtr = ARNETWORK_RingBuffer_GetDataPtr(IOBuffer->dataDescriptorRBuffer, numberOfData - 1);
+        memcpy(&dataDescriptor, newestDataDescriptorPtr, sizeof(ARNETWORK_DataDescriptor_t));
+
+        if (dataDescriptor.dataSize > dataLimitSize)
+        {
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        memcpy(data, dataDescriptor.data, dataDescriptor.dataSize);
+        localReadSize = dataDescriptor.dataSize;
+
+        /** the data of an output buffer are all copies: the data and their copies are popped by moving the output indexes */
+        ARNETWORK_RingBuffer_DiscardFront(IOBuffer->dataDescriptorRBuffer, numberOfData);
+        if (IOBuffer->dataCopyRBuffer != NULL)
+        {
+            ARNETWORK_RingBuffer_DiscardFront(IOBuffer->dataCopyRBuffer, numberOfData);
+        }
+
+        ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+    }
+    else
+    {
+        numberOfData = 0;
+    }
+
+    if (readSize != NULL)
+    {
+        *readSize = localReadSize;
+    }
+    *numberOfDataPoppedPtr = numberOfData;
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WriteLatestData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize)
+{
+    /** -- replace the data of the slot of a latest only output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    if ((IOBuffer->latestData == NULL) || (dataSize > IOBuffer->latestDataCapacity))
+    {
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+    }
+    else
+    {
+        ARNETWORK_IOBuffer_SetLatestData(IOBuffer, data, dataSize);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadLatestData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, int *readSize)
+{
+    /** -- read the data of the slot of a latest only output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    uint32_t sequenceBefore = 0;
+    uint32_t sequenceAfter = 0;
+    int dataSize = -1;
+
+    if (IOBuffer->latestData == NULL)
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+    else
+    {
+        /** read the slot until it is not written during the reading */
+        do
+        {
+            sequenceBefore = __atomic_load_n(&(IOBuffer->latestSequence), __ATOMIC_ACQUIRE);
+            if (sequenceBefore & 1)
+            {
+                continue;
+            }
+
+            dataSize = __atomic_load_n(&(IOBuffer->latestDataSize), __ATOMIC_RELAXED);
+            if ((dataSize > 0) && ((size_t) dataSize <= dataLimitSize))
+            {
+                memcpy(data, IOBuffer->latestData, dataSize);
+            }
+
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            sequenceAfter = __atomic_load_n(&(IOBuffer->latestSequence), __ATOMIC_RELAXED);
+        }
+        while ((sequenceBefore & 1) || (sequenceBefore != sequenceAfter));
+
+        if (dataSize < 0)
+        {
+            error = ARNETWORK_ERROR_BUFFER_EMPTY;
+        }
+        else if ((size_t) dataSize > dataLimitSize)
+        {
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+    }
+
+    if (readSize != NULL)
+    {
+        *readSize = (error == ARNETWORK_OK) ? dataSize : 0;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_BorrowData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t **dataPtrAddr, int *dataSizePtr)
+{
+    /** -- borrow the oldest data received in a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+
+    if (IOBuffer->isDataBorrowed)
+    {
+        error = ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED;
+    }
+    else
+    {
+        error = ARNETWORK_RingBuffer_Front(IOBuffer->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the data stays in its cell of the data copy until it is released */
+        IOBuffer->isDataBorrowed = 1;
+        *dataPtrAddr = dataDescriptor.data;
+        *dataSizePtr = dataDescriptor.dataSize;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReleaseData(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    /** -- pop the data borrowed -- */
+
+    if (!IOBuffer->isDataBorrowed)
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    IOBuffer->isDataBorrowed = 0;
+    error = ARNETWORK_IOBuffer_PopData(IOBuffer);
+
+    if (ARNETWORK_RingBuffer_IsEmpty(IOBuffer->dataDescriptorRBuffer))
+    {
+        ARNETWORK_IOBuffer_UpdateReadableEventFd(IOBuffer);
+    }
+
+    return error;
+}
+
 int ARNETWORK_IOBuffer_GetEstimatedMissPercentage (ARNETWORK_IOBuffer_t *IOBuffer)
 {
     if (IOBuffer == NULL)
@@ -40,9 +40,13 @@
 
 #include <libARNetworkAL/ARNETWORKAL_Frame.h>
 #include "ARNETWORK_RingBuffer.h"
+#include "ARNETWORK_DataDescriptor.h"
+#include "ARNETWORK_LockFreeQueue.h"
+#include "ARNETWORK_BroadcastRing.h"
 #include <libARNetwork/ARNETWORK_IOBufferParam.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Sem.h>
+#include <libARSAL/ARSAL_Time.h>
 
 /*****************************************
  *
@@ -64,15 +68,53 @@ typedef struct
     int sendingWaitTimeMs;  /**< Time in millisecond between 2 send when the InOutBuffer if used with a libARNetwork/sender*/
     int ackTimeoutMs; /**< Timeout in millisecond after retry to send the data when the InOutBuffer is used with a libARNetwork/sender*/
     int numberOfRetry; /**< Maximum number of retry of sending before to consider a failure when the InOutBuffer is used with a libARNetwork/sender*/
+    int coalescingKeySize; /**< Number of leading bytes of the data used as coalescing key (0 = coalescing disabled) */
+    int rateLimit; /**< Maximum sending rate in rateLimitUnit per second when the InOutBuffer is used with a libARNetwork/sender (0 = no limit) */
+    int rateLimitBurst; /**< Size of the token bucket in rateLimitUnit */
+    eARNETWORK_IOBUFFERPARAM_RATELIMITUNIT rateLimitUnit; /**< Unit of rateLimit and rateLimitBurst */
+    int sendBurstSize; /**< Maximum number of data sent in one pass when the InOutBuffer is used with a libARNetwork/sender (ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER = until the ARNetworkAL buffer is full) */
+    eARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY overflowPolicy; /**< Behavior of the input buffer when its data does not fit in the ARNetworkAL buffer */
+    int alHeadroomSize; /**< Size, in byte, of the ARNetworkAL buffer left free by the input buffer in each pass of the sender */
+    int isSendingInline; /**< Indicator of sending from the thread adding the data, when the buffer is empty (1 = true | 0 = false) */
+    int senderLane; /**< Index of the sender lane processing the buffer */
+    int receiverShard; /**< Index of the receiver shard processing the data received by the buffer */
+    int isLockFree; /**< Indicator of adding the data of ARNETWORK_IOBuffer_AddDataLockFree() without lock (1 = true | 0 = false) */
+    ARNETWORK_LockFreeQueue_t *lockFreeQueue; /**< Queue of the data added without lock, moved in the RingBuffers by ARNETWORK_IOBuffer_Lock() (NULL if isLockFree is 0) */
+    int lockFreeNumberOfFreeCells; /**< Number of data which can still be added in a lock-free IOBuffer, in lockFreeQueue or in the RingBuffers ; accessed atomically */
+    int isFlowControlled; /**< Indicator of free cells advertised on the acknowledgements (1 = true | 0 = false) */
+    int hasAdvertisedNoFreeCell; /**< Indicator of the output buffer having advertised it is full, so it must advertise its next free cell (1 = true | 0 = false) */
 
     int isWaitAck; /**< Indicator of waiting an acknowledgement  (1 = true | 0 = false). Must be accessed through ARNETWORK_IOBuffer_IsWaitAck()*/
     int alreadyHadData; /**< Init flag (to avoid sequence number conflicts) */
     uint8_t seq; /**< Sequence number for data sent from this buffer or last sequence number received */
     uint32_t nbPackets; /**< Number of packets sent/received since the creation of the buffer */
     uint32_t nbNetwork; /**< Total number of packets sent/received, including misses (based on sequence numbers) */
+    uint32_t nbOverflows; /**< Number of times a data of the input buffer did not fit in the ARNetworkAL buffer */
+    uint32_t nbDrops; /**< Number of data of the input buffer discarded because they did not fit in the ARNetworkAL buffer */
     int waitTimeCount; /**< Counter of time to wait before the next sending*/
     int ackWaitTimeCount; /**< Counter of time to wait before to consider a timeout without receiving an acknowledgement*/
     int retryCount; /**< Counter of sending retry remaining before to consider a failure*/
+    int flowControlWaitTimeCount; /**< Counter of time to wait before to send again after the output buffer of the remote device advertised it is full (0 = not paused) */
+    int64_t rateLimitTokens; /**< Tokens available in the token bucket, in millionths of rateLimitUnit ; negative after sending a frame larger than the bucket */
+    struct timespec rateLimitRefillTime; /**< Date of the last refill of the token bucket */
+
+    uint8_t *periodicData; /**< Slot of the data sent periodically (NULL = no periodic data). Must be accessed through ARNETWORK_IOBuffer_IsPeriodic()*/
+    int periodicDataSize; /**< Size of the periodic data */
+    int periodicDataCapacity; /**< Size of the slot of the periodic data */
+    int periodicPeriodMs; /**< Period of the sendings of the periodic data in millisecond */
+    struct timespec periodicNextTime; /**< Date of the next sending of the periodic data */
+    ARNETWORK_Manager_PeriodicDataUpdate_t periodicUpdateCallback; /**< Callback updating the periodic data before each sending (can be NULL) */
+    void *periodicCustomData; /**< Custom data sent to periodicUpdateCallback */
+    uint32_t dataHandleCount; /**< Number of data handles given by the IOBuffer, used to build the next one */
+    int isDataBorrowed; /**< Indicator of the oldest data of the output buffer lent to a reader, not popped nor overwritten until it is released (1 = true | 0 = false) */
+    ARNETWORK_Manager_OutputHandler_t outputHandler; /**< Handler called by the receiver with the data received, instead of storing them (NULL = data stored) */
+    void *outputHandlerCustomData; /**< Custom data sent to outputHandler */
+    int isLatestOnly; /**< Indicator of keeping only the latest data received, in latestData (1 = true | 0 = false) */
+    uint8_t *latestData; /**< Slot of the latest data received by a latest only output buffer (NULL if isLatestOnly is 0) */
+    int latestDataCapacity; /**< Size of latestData */
+    int latestDataSize; /**< Size of the data in latestData (-1 = no data) ; accessed atomically */
+    uint32_t latestSequence; /**< Sequence counter of the seqlock protecting latestData, odd while it is written ; accessed atomically */
+    ARNETWORK_BroadcastRing_t *broadcastRing; /**< Ring of the data received, read by each subscriber of the output buffer (NULL if maxNumberOfSubscribers is 0) */
 
     ARSAL_Mutex_t mutex;  /**< Mutex to take before to use the IOBuffer.
                            *   @warning This mutex is not managed by the IOBuffer itself but by the user
@@ -80,6 +122,12 @@ typedef struct
                            *   @see ARNETWORK_IOBuffer_Unlock()
                            */
     ARSAL_Sem_t outputSem; /**< Semaphore used, by the outputs, to know when a data is ready to be read */
+    ARSAL_Cond_t writableCond; /**< Condition signaled, with the mutex, when a full input buffer gets a free cell */
+    int writableWaitersCount; /**< Number of threads waiting writableCond */
+#ifdef ENABLE_MONITOR_INCOMING_DATA
+    int writableEventFd; /**< eventfd readable while the input buffer is not full (-1 = not created yet). Must be accessed through ARNETWORK_IOBuffer_GetWritableEventFd()*/
+    int readableEventFd; /**< eventfd readable while the output buffer is not empty (-1 = not created yet). Must be accessed through ARNETWORK_IOBuffer_GetReadableEventFd()*/
+#endif
 
 }ARNETWORK_IOBuffer_t;
 
@@ -112,6 +160,25 @@ static inline int ARNETWORK_IOBuffer_CanCopyData(ARNETWORK_IOBuffer_t *IOBuffer)
     return (IOBuffer->dataCopyRBuffer != NULL) ? 1 : 0;
 }
 
+/**
+ * @brief Get the maximum size of a data stored by an output buffer
+ * @details A latest-only or broadcast output buffer stores its data in its own slot or ring, not in its data copy.
+ * @param IOBuffer The output buffer
+ * @return the maximum size of a data stored, 0 if the output buffer can not store any data
+ */
+static inline int ARNETWORK_IOBuffer_GetDataMaxSize(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    if (IOBuffer->latestData != NULL)
+    {
+        return IOBuffer->latestDataCapacity;
+    }
+    if (IOBuffer->broadcastRing != NULL)
+    {
+        return (int) IOBuffer->broadcastRing->cellSize;
+    }
+    return (IOBuffer->dataCopyRBuffer != NULL) ? (int) IOBuffer->dataCopyRBuffer->cellSize : 0;
+}
+
 /**
  * @brief Receive an acknowledgement to a IOBuffer.
  * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
@@ -131,6 +198,8 @@ int ARNETWORK_IOBuffer_IsWaitAck (ARNETWORK_IOBuffer_t *IOBuffer);
 
 /**
  * @brief Lock the IOBuffer's mutex.
+ * @details The data added in a lock-free IOBuffer since the previous lock are moved at the end of its RingBuffers,
+ * so that the locked IOBuffer contains all its data in the order of their adding.
  * @param IOBuffer The IOBuffer.
  * @return error equal to ARNETWORK_OK if the data are correctly locked, otherwise see eARNETWORK_ERROR
  */
@@ -174,6 +243,113 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_PopDataWithCallBack(ARNETWORK_IOBuffer_t *IO
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush (ARNETWORK_IOBuffer_t *IOBuffer);
 
+/**
+ * @brief Check if the IOBuffer has no free cell for a new data
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after, unless it is lock-free.
+ * @param IOBuffer Pointer on the input or output buffer
+ * @return 1 if the IOBuffer is full, otherwise 0 ; an overwriting IOBuffer is never full
+ */
+static inline int ARNETWORK_IOBuffer_IsFull(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    if (IOBuffer->isLockFree)
+    {
+        /** the cells of a lock-free IOBuffer are taken by the producers before they add their data */
+        return (__atomic_load_n(&(IOBuffer->lockFreeNumberOfFreeCells), __ATOMIC_ACQUIRE) <= 0) ? 1 : 0;
+    }
+
+    return ((IOBuffer->dataDescriptorRBuffer->isOverwriting == 0) &&
+            (ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer) == 0)) ? 1 : 0;
+}
+
+/**
+ * @brief Get the number of free cells of the IOBuffer
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the input or output buffer
+ * @return number of data which can be added before the IOBuffer is full
+ */
+static inline int ARNETWORK_IOBuffer_GetNumberOfFreeCells(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    if (IOBuffer->isLockFree)
+    {
+        /** the cells taken by the producers which did not finish adding their data are not free */
+        return __atomic_load_n(&(IOBuffer->lockFreeNumberOfFreeCells), __ATOMIC_ACQUIRE);
+    }
+
+    return ARNETWORK_RingBuffer_GetFreeCellNumber(IOBuffer->dataDescriptorRBuffer);
+}
+
+/**
+ * @brief Wait for a free cell in a full IOBuffer
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after ; it is unlocked during the wait.
+ * @param IOBuffer Pointer on the input buffer
+ * @param[in] timeoutMs maximum time in millisecond to wait
+ * @return error equal to ARNETWORK_OK if the IOBuffer has a free cell, ARNETWORK_ERROR_BUFFER_SIZE if it is still full after the wait
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WaitWritable(ARNETWORK_IOBuffer_t *IOBuffer, int timeoutMs);
+
+/**
+ * @brief Get the eventfd readable while the output buffer is not empty
+ * @details The eventfd is created by the first call ; it is closed by ARNETWORK_IOBuffer_Delete().
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the output buffer
+ * @param[out] fd File descriptor of the eventfd
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER if eventfd is not supported
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_GetReadableEventFd(ARNETWORK_IOBuffer_t *IOBuffer, int *fd);
+
+/**
+ * @brief Update the readable eventfd of the output buffer, if it is created
+ * @details Called when the output buffer becomes empty or not empty: the eventfd is only written and read on these transitions.
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the output buffer
+ */
+void ARNETWORK_IOBuffer_UpdateReadableEventFd(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Get the eventfd readable while the IOBuffer is not full
+ * @details The eventfd is created by the first call ; it is closed by ARNETWORK_IOBuffer_Delete().
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the input buffer
+ * @param[out] fd File descriptor of the eventfd
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER if eventfd is not supported
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_GetWritableEventFd(ARNETWORK_IOBuffer_t *IOBuffer, int *fd);
+
+/**
+ * @brief Get the number of data waiting to be sent in the IOBuffer
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the input buffer
+ * @return number of data in the IOBuffer, not counting the canceled data
+ */
+int ARNETWORK_IOBuffer_GetNumberOfData(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Estimate the time needed by the sender to send all the data of the IOBuffer
+ * @details The estimation takes in account the sendingWaitTimeMs and the sendBurstSize of the IOBuffer,
+ * its token bucket, and the acknowledgement of each data for the buffers of data with ack.
+ * @warning the IOBuffer must be locked before the calling of this function and unlock after.
+ * @param IOBuffer Pointer on the input buffer
+ * @param[in] roundTripTimeMs estimated time in millisecond between the sending of a data and the reception of its acknowledgement (negative if unknown)
+ * @return estimated time in millisecond
+ */
+int ARNETWORK_IOBuffer_GetEstimatedDrainTimeMs(ARNETWORK_IOBuffer_t *IOBuffer, int roundTripTimeMs);
+
+/**
+ * @brief Add data in a lock-free IOBuffer without taking its mutex
+ * @details The data is added in the lock-free queue of the IOBuffer, and moved at the end of its RingBuffers by the next ARNETWORK_IOBuffer_Lock().
+ * Any number of threads can call this function at the same time.
+ * @warning the IOBuffer must be created with isLockFree set, and must not be locked by the calling thread.
+ * @param IOBuffer Pointer on the input buffer
+ * @param[in] data pointer on the data to add
+ * @param[in] dataSize size in byte of the data to add
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indocator to copy the data in the IOBuffer
+ * @param[out] wasEmptyPtr set to 1 if the IOBuffer was empty before the adding, otherwise 0
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if the IOBuffer is full
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataLockFree(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int *wasEmptyPtr);
+
 /**
  * @brief Add data in a IOBuffer
  * @param IOBuffer The input or output buffer
@@ -186,6 +362,231 @@ eARNETWORK_ERROR ARNETWORK_IOBuffer_Flush (ARNETWORK_IOBuffer_t *IOBuffer);
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_AddData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
 
+/**
+ * @brief Add data in a IOBuffer, to send at a given date
+ * @details The data keeps its place in the IOBuffer: it is not sent before the given date, and the data added after it wait its sending.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] data The data to add
+ * @param[in] dataSize size of the data to add
+ * @param[in] sendTime monotonic date (ARSAL_Time_GetTime() clock) before which the data is not sent ; NULL to send it as soon as possible
+ * @param[in] handle handle of the data returned by ARNETWORK_IOBuffer_NewDataHandle(), or 0
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indocator to copy the data in the IOBuffer
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_AddData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataAt(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, const struct timespec *sendTime, uint32_t handle, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Add the copy of a data made of several segments in a IOBuffer
+ * @details The segments are copied one after the other in the data copy cell, without intermediate buffer.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer, which must have a data copy
+ * @param[in] segmentArr array of the segments of the data
+ * @param[in] numberOfSegments number of segments in segmentArr
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_AddData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataSegments(ARNETWORK_IOBuffer_t *IOBuffer, const struct iovec *segmentArr, int numberOfSegments, void *customData, ARNETWORK_Manager_Callback_t callback);
+
+/**
+ * @brief Add the data of a reference-counted buffer in a IOBuffer, without copy
+ * @details The IOBuffer takes a reference on the buffer, released when the data is freed.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] buffer buffer holding the data
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred ; can be equal to NULL
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_IOBuffer_AddData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddBuffer(ARNETWORK_IOBuffer_t *IOBuffer, ARNETWORK_Buffer_t *buffer, void *customData, ARNETWORK_Manager_Callback_t callback);
+
+/**
+ * @brief Add data in a IOBuffer with an explicit coalescing key
+ * @details If the IOBuffer is coalescing and a data with the same key is still waiting to be sent,
+ * this data is replaced in place by the new one and its callback is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] data The data to add
+ * @param[in] dataSize size of the data to add
+ * @param[in] key coalescing key of the data
+ * @param[in] handle handle of the data returned by ARNETWORK_IOBuffer_NewDataHandle(), or 0
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indocator to copy the data in the IOBuffer
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_AddDataWithKey(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataSize, uint32_t key, uint32_t handle, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
+
+/**
+ * @brief Get a new data handle of the IOBuffer
+ * @details The identifier of the IOBuffer is stored in the low byte of the handle, see ARNETWORK_IOBUFFER_DATA_HANDLE_ID().
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @return the new handle, never 0
+ */
+uint32_t ARNETWORK_IOBuffer_NewDataHandle(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Get the identifier of the IOBuffer which gave a data handle
+ */
+#define ARNETWORK_IOBUFFER_DATA_HANDLE_ID(handle) ((int)((handle) & 0xFF))
+
+/**
+ * @brief Cancel a data of the IOBuffer
+ * @details The callback of the data is called with the ARNETWORK_MANAGER_CALLBACK_STATUS_CANCEL status, then the data is freed.
+ * A data queued behind other data keeps its cell until it reaches the front of the IOBuffer, but it is never sent.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] handle handle of the data
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND if no data of the IOBuffer has this handle
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_CancelData(ARNETWORK_IOBuffer_t *IOBuffer, uint32_t handle);
+
+/**
+ * @brief Replace in place the content of a data of the IOBuffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] handle handle of the data
+ * @param[in] data The new content of the data
+ * @param[in] dataSize size of the new content
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND if no data of the IOBuffer has this handle,
+ * ARNETWORK_ERROR_BUFFER_SIZE if the new content is larger than the cells of the data copies
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReplaceData(ARNETWORK_IOBuffer_t *IOBuffer, uint32_t handle, uint8_t *data, size_t dataSize);
+
+/**
+ * @brief Get the time to wait before the sending date of a data
+ * @param dataDescriptor The data descriptor of the data
+ * @param[in] now current date
+ * @return time to wait in microsecond ; 0 if the data has no sending date or if it is reached
+ */
+static inline int64_t ARNETWORK_IOBuffer_GetDataSendWaitTimeUs(const ARNETWORK_DataDescriptor_t *dataDescriptor, const struct timespec *now)
+{
+    int64_t waitTimeUs = 0;
+
+    if (dataDescriptor->hasSendTime)
+    {
+        waitTimeUs = ((int64_t)(dataDescriptor->sendTime.tv_sec - now->tv_sec) * 1000000) +
+            ((dataDescriptor->sendTime.tv_nsec - now->tv_nsec) / 1000);
+    }
+
+    return (waitTimeUs > 0) ? waitTimeUs : 0;
+}
+
+/**
+ * @brief Possibility of the IOBuffer to coalesce the data
+ * @param IOBuffer The input or output buffer
+ * @return 1 if the data with the same key are coalesced otherwise 0
+ */
+static inline int ARNETWORK_IOBuffer_IsCoalescing(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    return (IOBuffer->coalescingKeySize > 0) ? 1 : 0;
+}
+
+/**
+ * @brief Possibility of the IOBuffer to limit its sending rate
+ * @param IOBuffer The input buffer
+ * @return 1 if the sending of the IOBuffer is limited by a token bucket otherwise 0
+ */
+static inline int ARNETWORK_IOBuffer_IsRateLimited(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    return (IOBuffer->rateLimit > 0) ? 1 : 0;
+}
+
+/**
+ * @brief Get the time to wait before the token bucket of the IOBuffer allows to send a frame
+ * @details The token bucket is refilled according to the time elapsed since the last refill.
+ * A frame larger than the token bucket is allowed when the bucket is full.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] frameSize size of the frame to send, in bytes
+ * @return 0 if the frame can be sent now, otherwise the time to wait in millisecond
+ * @see ARNETWORK_IOBuffer_ConsumeRateLimitTokens()
+ */
+int ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize);
+
+/**
+ * @brief Remove the tokens of a frame sent from the token bucket of the IOBuffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] frameSize size of the frame sent, in bytes
+ * @see ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs()
+ */
+void ARNETWORK_IOBuffer_ConsumeRateLimitTokens(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize);
+
+/**
+ * @brief Give back to the token bucket of the IOBuffer the tokens of a frame consumed but finally not sent
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] frameSize size of the frame not sent, in bytes
+ * @see ARNETWORK_IOBuffer_ConsumeRateLimitTokens()
+ */
+void ARNETWORK_IOBuffer_RefundRateLimitTokens(ARNETWORK_IOBuffer_t *IOBuffer, int frameSize);
+
+/**
+ * @brief Check if the IOBuffer sends a periodic data
+ * @param IOBuffer The input buffer
+ * @return 1 if a periodic data is set, otherwise 0
+ */
+static inline int ARNETWORK_IOBuffer_IsPeriodic(ARNETWORK_IOBuffer_t *IOBuffer)
+{
+    return (IOBuffer->periodicData != NULL) ? 1 : 0;
+}
+
+/**
+ * @brief Start to send a data periodically in the IOBuffer
+ * @details The data is copied in the slot of the periodic data ; its first sending is due now.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] data pointer on the data
+ * @param[in] dataSize size of the data
+ * @param[in] maxDataSize maximum size of the data in a frame of ARNetworkAL ; bounds the size of the slot
+ * @param[in] periodMs period of the sendings in millisecond
+ * @param[in] updateCallback callback updating the data before each sending ; can be NULL
+ * @param[in] customData custom data sent to the updateCallback
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_SIZE if dataSize is greater than maxDataSize
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_StartPeriodicData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize, int maxDataSize, int periodMs, ARNETWORK_Manager_PeriodicDataUpdate_t updateCallback, void *customData);
+
+/**
+ * @brief Update the periodic data of the IOBuffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ * @param[in] data pointer on the new data
+ * @param[in] dataSize size of the new data
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_UpdatePeriodicData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize);
+
+/**
+ * @brief Stop to send the periodic data of the IOBuffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer
+ */
+void ARNETWORK_IOBuffer_StopPeriodicData(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Get the time to wait before the next sending of the periodic data of the IOBuffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer sending a periodic data
+ * @return 0 if the periodic data must be sent now, otherwise the time to wait in millisecond
+ */
+int ARNETWORK_IOBuffer_GetPeriodicWaitTimeMs(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief Schedule the next sending of the periodic data of the IOBuffer, one period after the sending due
+ * @details The periods missed are skipped.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The input buffer sending a periodic data
+ */
+void ARNETWORK_IOBuffer_SchedulePeriodicData(ARNETWORK_IOBuffer_t *IOBuffer);
+
 /**
  * @brief Asks an IOBuffer if it should accept a data with the given sequence number
  * @param IOBuffer The output buffer
@@ -203,10 +604,86 @@ int ARNETWORK_IOBuffer_ShouldAcceptData (ARNETWORK_IOBuffer_t *IOBuffer, uint8_t
  * @param[out] data The data read
  * @param[in] dataLimitSize limit size of the copy
  * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL
- * @return error eARNETWORK_ERROR type
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if the oldest data is borrowed
  */
 eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, int *readSize);
 
+/**
+ * @brief read several data received in a IOBuffer
+ * @details the data are copied one after the other in data ; the reading stops at maxNumberOfSlices data or at the first data which does not fit.
+ * The data descriptors are read by chunks of ARNETWORK_IOBUFFER_READBATCH_CHUNK_SIZE in one lock of their RingBuffer, and the data read are popped with their copies in one operation on each RingBuffer.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @warning the data read are pop
+ * @param IOBuffer The output buffer
+ * @param[out] data buffer in which the data are copied
+ * @param[in] dataLimitSize size of data
+ * @param[out] sliceArr slices describing the data read
+ * @param[in] maxNumberOfSlices maximum number of data to read
+ * @param[out] numberOfSlicesPtr pointer to store the number of data read
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_OK if at least one data is read
+ * @see ARNETWORK_IOBuffer_ReadData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadDataBatch(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, ARNETWORK_Manager_ReadSlice_t *sliceArr, int maxNumberOfSlices, int *numberOfSlicesPtr);
+
+/**
+ * @brief Borrow the oldest data received in a IOBuffer, without copy
+ * @details The data stays in the IOBuffer, which does not pop nor overwrite it until ARNETWORK_IOBuffer_ReleaseData() is called.
+ * Only one data of the IOBuffer can be borrowed at a time.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ * @param[out] dataPtrAddr address to store the pointer on the data in the IOBuffer
+ * @param[out] dataSizePtr pointer to store the size of the data
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if a data is already borrowed
+ * @see ARNETWORK_IOBuffer_ReleaseData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_BorrowData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t **dataPtrAddr, int *dataSizePtr);
+
+/**
+ * @brief Pop the data borrowed by ARNETWORK_IOBuffer_BorrowData()
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param IOBuffer The output buffer
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BAD_PARAMETER if no data is borrowed
+ * @see ARNETWORK_IOBuffer_BorrowData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReleaseData(ARNETWORK_IOBuffer_t *IOBuffer);
+
+/**
+ * @brief read the newest data received in a IOBuffer, and pop it with all the older data
+ * @details the older data are popped at once, without being read.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @warning only available on output buffers: the data popped are not freed through their callback
+ * @param IOBuffer The output buffer
+ * @param[out] data The data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL
+ * @param[out] numberOfDataPoppedPtr pointer to store the number of data popped, the data read included
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED if the oldest data is borrowed ; ARNETWORK_ERROR_BUFFER_SIZE, without popping any data, if the newest data does not fit in data
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadNewestData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, int *readSize, int *numberOfDataPoppedPtr);
+
+/**
+ * @brief replace the data of the slot of a latest only output buffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after: there is only one writer of the slot
+ * @param IOBuffer The latest only output buffer
+ * @param[in] data The data received
+ * @param[in] dataSize size of the data
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_SIZE if the data does not fit in the slot
+ * @see ARNETWORK_IOBuffer_ReadLatestData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_WriteLatestData(ARNETWORK_IOBuffer_t *IOBuffer, const uint8_t *data, int dataSize);
+
+/**
+ * @brief read the data of the slot of a latest only output buffer
+ * @details the slot is read without taking the IOBuffer mutex: the reading is retried if the slot is written meanwhile. The data stays in the slot.
+ * @param IOBuffer The latest only output buffer
+ * @param[out] data The data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL
+ * @return error eARNETWORK_ERROR type ; ARNETWORK_ERROR_BUFFER_EMPTY if no data was received
+ * @see ARNETWORK_IOBuffer_WriteLatestData()
+ */
+eARNETWORK_ERROR ARNETWORK_IOBuffer_ReadLatestData(ARNETWORK_IOBuffer_t *IOBuffer, uint8_t *data, size_t dataLimitSize, int *readSize);
+
 /**
  * @brief Gets the estimated miss percentage of the buffer
  * This functions behavior is undefined on input buffer
@@ -66,6 +66,20 @@
 #define ARNETWORK_IOBUFFER_NUMBER_OF_CELL_DEFAULT 0
 #define ARNETWORK_IOBUFFER_MAX_SIZE_OF_DATA_COPY_DEFAULT 0
 #define ARNETWORK_IOBUFFER_OVERWRITING_DEFAULT 0
+#define ARNETWORK_IOBUFFER_COALESCING_KEY_SIZE_DEFAULT 0
+#define ARNETWORK_IOBUFFER_RATE_LIMIT_DEFAULT 0
+#define ARNETWORK_IOBUFFER_RATE_LIMIT_BURST_DEFAULT 0
+#define ARNETWORK_IOBUFFER_RATE_LIMIT_UNIT_DEFAULT ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_BYTES
+#define ARNETWORK_IOBUFFER_SEND_BURST_SIZE_DEFAULT 1
+#define ARNETWORK_IOBUFFER_OVERFLOW_POLICY_DEFAULT ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_DROP
+#define ARNETWORK_IOBUFFER_AL_HEADROOM_SIZE_DEFAULT 0
+#define ARNETWORK_IOBUFFER_SENDING_INLINE_DEFAULT 0
+#define ARNETWORK_IOBUFFER_SENDER_LANE_DEFAULT 0
+#define ARNETWORK_IOBUFFER_RECEIVER_SHARD_DEFAULT 0
+#define ARNETWORK_IOBUFFER_LOCK_FREE_DEFAULT 0
+#define ARNETWORK_IOBUFFER_FLOW_CONTROLLED_DEFAULT 0
+#define ARNETWORK_IOBUFFER_LATEST_ONLY_DEFAULT 0
+#define ARNETWORK_IOBUFFER_MAX_NUMBER_OF_SUBSCRIBERS_DEFAULT 0
 
 /*****************************************
  *
@@ -91,6 +105,20 @@ eARNETWORK_ERROR ARNETWORK_IOBufferParam_DefaultInit (ARNETWORK_IOBufferParam_t
         IOBufferParam->numberOfCell = ARNETWORK_IOBUFFER_NUMBER_OF_CELL_DEFAULT;
         IOBufferParam->dataCopyMaxSize = ARNETWORK_IOBUFFER_MAX_SIZE_OF_DATA_COPY_DEFAULT;
         IOBufferParam->isOverwriting = ARNETWORK_IOBUFFER_OVERWRITING_DEFAULT;
+        IOBufferParam->coalescingKeySize = ARNETWORK_IOBUFFER_COALESCING_KEY_SIZE_DEFAULT;
+        IOBufferParam->rateLimit = ARNETWORK_IOBUFFER_RATE_LIMIT_DEFAULT;
+        IOBufferParam->rateLimitBurst = ARNETWORK_IOBUFFER_RATE_LIMIT_BURST_DEFAULT;
+        IOBufferParam->rateLimitUnit = ARNETWORK_IOBUFFER_RATE_LIMIT_UNIT_DEFAULT;
+        IOBufferParam->sendBurstSize = ARNETWORK_IOBUFFER_SEND_BURST_SIZE_DEFAULT;
+        IOBufferParam->overflowPolicy = ARNETWORK_IOBUFFER_OVERFLOW_POLICY_DEFAULT;
+        IOBufferParam->alHeadroomSize = ARNETWORK_IOBUFFER_AL_HEADROOM_SIZE_DEFAULT;
+        IOBufferParam->isSendingInline = ARNETWORK_IOBUFFER_SENDING_INLINE_DEFAULT;
+        IOBufferParam->senderLane = ARNETWORK_IOBUFFER_SENDER_LANE_DEFAULT;
+        IOBufferParam->isLockFree = ARNETWORK_IOBUFFER_LOCK_FREE_DEFAULT;
+        IOBufferParam->receiverShard = ARNETWORK_IOBUFFER_RECEIVER_SHARD_DEFAULT;
+        IOBufferParam->isFlowControlled = ARNETWORK_IOBUFFER_FLOW_CONTROLLED_DEFAULT;
+        IOBufferParam->isLatestOnly = ARNETWORK_IOBUFFER_LATEST_ONLY_DEFAULT;
+        IOBufferParam->maxNumberOfSubscribers = ARNETWORK_IOBUFFER_MAX_NUMBER_OF_SUBSCRIBERS_DEFAULT;
     }
     else
     {
@@ -114,7 +142,32 @@ int ARNETWORK_IOBufferParam_Check (const ARNETWORK_IOBufferParam_t *IOBufferPara
         (IOBufferParam->dataType != ARNETWORKAL_FRAME_TYPE_UNINITIALIZED) &&
         (IOBufferParam->sendingWaitTimeMs >= 0) &&
         (IOBufferParam->ackTimeoutMs >= -1) &&
-        (IOBufferParam->numberOfRetry >= -1))
+        (IOBufferParam->numberOfRetry >= -1) &&
+        (IOBufferParam->coalescingKeySize >= 0) &&
+        (IOBufferParam->coalescingKeySize <= ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX) &&
+        (IOBufferParam->rateLimit >= 0) &&
+        (IOBufferParam->rateLimitBurst >= 0) &&
+        (IOBufferParam->rateLimitUnit >= 0) &&
+        (IOBufferParam->rateLimitUnit < ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_MAX) &&
+        ((IOBufferParam->sendBurstSize >= 0) || (IOBufferParam->sendBurstSize == ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER)) &&
+        (IOBufferParam->overflowPolicy >= 0) &&
+        (IOBufferParam->overflowPolicy < ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_MAX) &&
+        (IOBufferParam->alHeadroomSize >= 0) &&
+        ((IOBufferParam->isSendingInline == 0) ||
+         ((IOBufferParam->isSendingInline == 1) &&
+          ((IOBufferParam->dataType == ARNETWORKAL_FRAME_TYPE_DATA) || (IOBufferParam->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY)))) &&
+        (IOBufferParam->senderLane >= 0) &&
+        (IOBufferParam->senderLane < ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX) &&
+        ((IOBufferParam->isLockFree == 0) ||
+         ((IOBufferParam->isLockFree == 1) && (IOBufferParam->isOverwriting == 0) && (IOBufferParam->coalescingKeySize == 0) && (IOBufferParam->isSendingInline == 0))) &&
+        (IOBufferParam->receiverShard >= 0) &&
+        (IOBufferParam->receiverShard < ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX) &&
+        ((IOBufferParam->isFlowControlled == 0) ||
+         ((IOBufferParam->isFlowControlled == 1) && (IOBufferParam->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK) && (IOBufferParam->isOverwriting == 0))) &&
+        ((IOBufferParam->isLatestOnly == 0) || (IOBufferParam->isLatestOnly == 1)) &&
+        (IOBufferParam->maxNumberOfSubscribers >= 0) &&
+        (IOBufferParam->maxNumberOfSubscribers <= ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX) &&
+        ((IOBufferParam->maxNumberOfSubscribers == 0) || (IOBufferParam->isLatestOnly == 0)))
     {
         ok = 1;
     }
@@ -131,7 +184,21 @@ values expected: \n\
     - numberOfRetry > 0 or -1 if not used  (value set: %d)\n\
     - numberOfCell > 0 (value set: %d)\n\
     - dataCopyMaxSize >= 0 (value set: %d)\n\
-    - isOverwriting = 0 or 1 (value set: %d)",
+    - isOverwriting = 0 or 1 (value set: %d)\n\
+    - 0 <= coalescingKeySize <= %d (value set: %d)\n\
+    - rateLimit >= 0 (value set: %d)\n\
+    - rateLimitBurst >= 0 (value set: %d)\n\
+    - 0 <= rateLimitUnit < %d (value set: %d)\n\
+    - sendBurstSize >= 0, 0 for the default, or -1 if not limited (value set: %d)\n\
+    - 0 <= overflowPolicy < %d (value set: %d)\n\
+    - alHeadroomSize >= 0 (value set: %d)\n\
+    - isSendingInline = 0, or 1 with dataType = %d or %d (value set: %d)\n\
+    - 0 <= senderLane < %d (value set: %d)\n\
+    - isLockFree = 0, or 1 with isOverwriting, coalescingKeySize and isSendingInline = 0 (value set: %d)\n\
+    - 0 <= receiverShard < %d (value set: %d)\n\
+    - isFlowControlled = 0, or 1 with dataType = %d and isOverwriting = 0 (value set: %d)\n\
+    - isLatestOnly = 0 or 1 (value set: %d)\n\
+    - 0 <= maxNumberOfSubscribers <= %d, and 0 if isLatestOnly = 1 (value set: %d)",
                      ARNETWORK_IOBUFFER_ID_MIN, ARNETWORK_IOBUFFER_ID_MAX, IOBufferParam->ID,
                      ARNETWORKAL_FRAME_TYPE_UNINITIALIZED, IOBufferParam->dataType,
                      IOBufferParam->sendingWaitTimeMs,
@@ -139,7 +206,21 @@ values expected: \n\
                      IOBufferParam->numberOfRetry,
                      IOBufferParam->numberOfCell,
                      IOBufferParam->dataCopyMaxSize,
-                     IOBufferParam->isOverwriting);
+                     IOBufferParam->isOverwriting,
+                     ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX, IOBufferParam->coalescingKeySize,
+                     IOBufferParam->rateLimit,
+                     IOBufferParam->rateLimitBurst,
+                     ARNETWORK_IOBUFFERPARAM_RATELIMITUNIT_MAX, IOBufferParam->rateLimitUnit,
+                     IOBufferParam->sendBurstSize,
+                     ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_MAX, IOBufferParam->overflowPolicy,
+                     IOBufferParam->alHeadroomSize,
+                     ARNETWORKAL_FRAME_TYPE_DATA, ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY, IOBufferParam->isSendingInline,
+                     ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX, IOBufferParam->senderLane,
+                     IOBufferParam->isLockFree,
+                     ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX, IOBufferParam->receiverShard,
+                     ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK, IOBufferParam->isFlowControlled,
+                     IOBufferParam->isLatestOnly,
+                     ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX, IOBufferParam->maxNumberOfSubscribers);
         }
         else
         {
@@ -0,0 +1,222 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_LockFreeQueue.c
+ * @brief Bounded queue, lock-free for several producers and one consumer.
+ * @date 10/18/2026
+ **/
+
+/*****************************************
+ *
+ *             include file :
+ *
+ ******************************************/
+
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "ARNETWORK_LockFreeQueue.h"
+
+/*****************************************
+ *
+ *             define :
+ *
+ ******************************************/
+
+#define ARNETWORK_LOCKFREEQUEUE_CELL_ALIGNMENT (8) /**< alignment of the cells, for the sequence stamps and the data stored */
+
+/*****************************************
+ *
+ *             internal functions :
+ *
+ ******************************************/
+
+/**
+ * @brief Return the sequence stamp of a cell
+ * @param queue the queue
+ * @param[in] position position of the cell
+ * @return pointer on the sequence stamp of the cell
+**/
+static inline uint32_t *ARNETWORK_LockFreeQueue_GetStamp(ARNETWORK_LockFreeQueue_t *queue, uint32_t position)
+{
+    return (uint32_t *) (queue->cellBuffer + ((position & (queue->numberOfCell - 1)) * queue->cellStride));
+}
+
+/**
+ * @brief Return the data of a cell
+ * @param queue the queue
+ * @param[in] position position of the cell
+ * @return pointer on the data of the cell
+**/
+static inline uint8_t *ARNETWORK_LockFreeQueue_GetData(ARNETWORK_LockFreeQueue_t *queue, uint32_t position)
+{
+    return ((uint8_t *) ARNETWORK_LockFreeQueue_GetStamp(queue, position)) + ARNETWORK_LOCKFREEQUEUE_CELL_ALIGNMENT;
+}
+
+/*****************************************
+ *
+ *             implementation :
+ *
+ ******************************************/
+
+ARNETWORK_LockFreeQueue_t* ARNETWORK_LockFreeQueue_New(unsigned int numberOfCell, unsigned int cellSize)
+{
+    /* -- Create a new queue -- */
+
+    /* local declarations */
+    ARNETWORK_LockFreeQueue_t* queue = NULL;
+    uint32_t position = 0;
+
+    if (numberOfCell == 0)
+        return NULL;
+
+    queue = calloc(1, sizeof(ARNETWORK_LockFreeQueue_t));
+    if (queue == NULL)
+        return NULL;
+
+    /* the positions wrap around the cells without discontinuity with a power of two */
+    queue->numberOfCell = 1;
+    while (queue->numberOfCell < numberOfCell)
+    {
+        queue->numberOfCell <<= 1;
+    }
+    queue->cellSize = cellSize;
+    queue->cellStride = ARNETWORK_LOCKFREEQUEUE_CELL_ALIGNMENT + ((cellSize + ARNETWORK_LOCKFREEQUEUE_CELL_ALIGNMENT - 1) & ~(ARNETWORK_LOCKFREEQUEUE_CELL_ALIGNMENT - 1));
+    queue->enqueuePosition = 0;
+    queue->dequeuePosition = 0;
+
+    queue->cellBuffer = malloc(queue->cellStride * queue->numberOfCell);
+    if (queue->cellBuffer == NULL)
+    {
+        ARNETWORK_LockFreeQueue_Delete(&queue);
+        return NULL;
+    }
+
+    /* the cell of the position p is free for the producer of p when its stamp is p */
+    for (position = 0; position < queue->numberOfCell; ++position)
+    {
+        *ARNETWORK_LockFreeQueue_GetStamp(queue, position) = position;
+    }
+
+    return queue;
+}
+
+void ARNETWORK_LockFreeQueue_Delete(ARNETWORK_LockFreeQueue_t **queue)
+{
+    /* -- Delete the queue -- */
+
+    if (queue != NULL)
+    {
+        if((*queue) != NULL)
+        {
+            free((*queue)->cellBuffer);
+            (*queue)->cellBuffer = NULL;
+
+            free(*queue);
+            (*queue) = NULL;
+        }
+        /* No else: No queue to delete */
+    }
+    /* No else: Parameters check (stops the processing) */
+}
+
+uint8_t* ARNETWORK_LockFreeQueue_ReserveBack(ARNETWORK_LockFreeQueue_t *queue, uint32_t *positionPtr)
+{
+    /* -- Reserve the cell at the back of the queue -- */
+
+    /* local declarations */
+    uint32_t position = __atomic_load_n(&(queue->enqueuePosition), __ATOMIC_RELAXED);
+    uint32_t stamp = 0;
+    int32_t difference = 0;
+
+    for (;;)
+    {
+        stamp = __atomic_load_n(ARNETWORK_LockFreeQueue_GetStamp(queue, position), __ATOMIC_ACQUIRE);
+        difference = (int32_t) (stamp - position);
+
+        if (difference == 0)
+        {
+            /* the cell is free: take it unless another producer took it first */
+            if (__atomic_compare_exchange_n(&(queue->enqueuePosition), &position, position + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+            /* No else: position is updated by the compare and swap, try again */
+        }
+        else if (difference < 0)
+        {
+            /* the cell still holds the data of the previous lap: the queue is full */
+            return NULL;
+        }
+        else
+        {
+            /* another producer took the cell */
+            position = __atomic_load_n(&(queue->enqueuePosition), __ATOMIC_RELAXED);
+        }
+    }
+
+    *positionPtr = position;
+    return ARNETWORK_LockFreeQueue_GetData(queue, position);
+}
+
+void ARNETWORK_LockFreeQueue_CommitBack(ARNETWORK_LockFreeQueue_t *queue, uint32_t position)
+{
+    /* -- Publish a cell filled by a producer -- */
+    __atomic_store_n(ARNETWORK_LockFreeQueue_GetStamp(queue, position), position + 1, __ATOMIC_RELEASE);
+}
+
+uint8_t* ARNETWORK_LockFreeQueue_Front(ARNETWORK_LockFreeQueue_t *queue)
+{
+    /* -- Return a pointer on the front data -- */
+
+    /* local declarations */
+    uint32_t position = queue->dequeuePosition;
+    uint8_t *data = NULL;
+
+    if (__atomic_load_n(ARNETWORK_LockFreeQueue_GetStamp(queue, position), __ATOMIC_ACQUIRE) == position + 1)
+    {
+        data = ARNETWORK_LockFreeQueue_GetData(queue, position);
+    }
+
+    return data;
+}
+
+void ARNETWORK_LockFreeQueue_PopFront(ARNETWORK_LockFreeQueue_t *queue)
+{
+    /* -- Pop the front data and give back its cell to the producers -- */
+
+    /* local declarations */
+    uint32_t position = queue->dequeuePosition;
+
+    /* the cell is free for the producer of the same cell in the next lap */
+    __atomic_store_n(ARNETWORK_LockFreeQueue_GetStamp(queue, position), position + queue->numberOfCell, __ATOMIC_RELEASE);
+    queue->dequeuePosition = position + 1;
+}
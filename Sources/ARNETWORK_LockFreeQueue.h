@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the 
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED 
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file ARNETWORK_LockFreeQueue.h
+ * @brief Bounded queue, lock-free for several producers and one consumer.
+ * @date 10/18/2026
+**/
+
+#ifndef _ARNETWORK_LOCKFREEQUEUE_PRIVATE_H_
+#define _ARNETWORK_LOCKFREEQUEUE_PRIVATE_H_
+
+#include <inttypes.h>
+
+/**
+ * @brief Bounded queue, lock-free for several producers and one consumer
+ * @details Each cell has a sequence stamp telling if it is free for the producer of a position, or filled for the consumer.
+ * A producer reserves a cell with a compare and swap on the enqueue position, fills it, then publishes it by updating its stamp.
+ * The consumer reads the cells in the order of their positions.
+ * @warning The functions of the consumer must not be called by several threads at the same time.
+ * @warning before to be used the queue must be created through ARNETWORK_LockFreeQueue_New()
+ * @post after its using the queue must be deleted through ARNETWORK_LockFreeQueue_Delete()
+**/
+typedef struct
+{
+    uint8_t *cellBuffer; /**< the cells: a sequence stamp followed by the data */
+    unsigned int numberOfCell; /**< Number of cells, power of two */
+    unsigned int cellSize; /**< Size of the data of one cell in byte */
+    unsigned int cellStride; /**< Size of one cell in the cellBuffer, sequence stamp included */
+
+    uint32_t enqueuePosition; /**< Position of the next cell reserved by a producer ; accessed atomically */
+    uint8_t enqueuePadding[60]; /**< Padding keeping the positions of the producers and of the consumer on different cache lines */
+    uint32_t dequeuePosition; /**< Position of the next cell read by the consumer */
+
+}ARNETWORK_LockFreeQueue_t;
+
+/**
+ * @brief Create a new queue
+ * @warning This function allocate memory
+ * @post ARNETWORK_LockFreeQueue_Delete() must be called to delete the queue and free the memory allocated
+ * @param[in] numberOfCell Minimum number of cells of the queue ; rounded up to a power of two
+ * @param[in] cellSize size of the data of one cell
+ * @return Pointer on the new queue
+ * @see ARNETWORK_LockFreeQueue_Delete()
+**/
+ARNETWORK_LockFreeQueue_t* ARNETWORK_LockFreeQueue_New(unsigned int numberOfCell, unsigned int cellSize);
+
+/**
+ * @brief Delete the queue
+ * @warning This function free memory
+ * @param queue Pointer to the queue to delete
+ * @see ARNETWORK_LockFreeQueue_New()
+**/
+void ARNETWORK_LockFreeQueue_Delete(ARNETWORK_LockFreeQueue_t **queue);
+
+/**
+ * @brief Reserve the cell at the back of the queue (producer side)
+ * @post the cell must be published through ARNETWORK_LockFreeQueue_CommitBack()
+ * @param queue the queue
+ * @param[out] positionPtr position of the cell reserved
+ * @return pointer on the data of the cell reserved, or NULL if the queue is full
+ * @see ARNETWORK_LockFreeQueue_CommitBack()
+**/
+uint8_t* ARNETWORK_LockFreeQueue_ReserveBack(ARNETWORK_LockFreeQueue_t *queue, uint32_t *positionPtr);
+
+/**
+ * @brief Publish a cell filled by a producer to the consumer
+ * @param queue the queue
+ * @param[in] position position of the cell, given by ARNETWORK_LockFreeQueue_ReserveBack()
+ * @see ARNETWORK_LockFreeQueue_ReserveBack()
+**/
+void ARNETWORK_LockFreeQueue_CommitBack(ARNETWORK_LockFreeQueue_t *queue, uint32_t position);
+
+/**
+ * @brief Return a pointer on the front data (consumer side)
+ * @note a cell reserved and not yet published hides the cells published after it
+ * @param queue the queue
+ * @return pointer on the data of the front cell, or NULL if it is not published
+**/
+uint8_t* ARNETWORK_LockFreeQueue_Front(ARNETWORK_LockFreeQueue_t *queue);
+
+/**
+ * @brief Pop the front data and give back its cell to the producers (consumer side)
+ * @warning the front cell must be published (ARNETWORK_LockFreeQueue_Front() different of NULL)
+ * @param queue the queue
+**/
+void ARNETWORK_LockFreeQueue_PopFront(ARNETWORK_LockFreeQueue_t *queue);
+
+#endif /** _ARNETWORK_LOCKFREEQUEUE_PRIVATE_H_ */
@@ -92,6 +92,48 @@
  */
 eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParamArray, ARNETWORK_IOBufferParam_t *outputParamArray);
 
+/**
+ * @brief Add data to send in a IOBuffer and wake up the sender if needed
+ * @param manager The Manager
+ * @param[in] inputBufferID identifier of the input buffer in which the data must be stored
+ * @param[in] data pointer on the data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] hasKey 1 to use the given coalescing key, 0 to let the IOBuffer compute it
+ * @param[in] key coalescing key of the data, used only if hasKey is 1
+ * @param[in] sendTime date before which the data is not sent, or NULL to send it as soon as possible ; not used if hasKey is 1
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback to call when the data is sent or an error occurred
+ * @param[in] doDataCopy indicator to copy the data in the ARNETWORK_Manager
+ * @param[out] handlePtr pointer on the handle of the data, or NULL if the data does not need a handle
+ * @return error eARNETWORK_ERROR
+ * @see ARNETWORK_Manager_SendData()
+ * @see ARNETWORK_Manager_SendDataWithKey()
+ * @see ARNETWORK_Manager_SendDataAt()
+ * @see ARNETWORK_Manager_SendDataWithHandle()
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_AddDataToSend (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, int hasKey, uint32_t key, const struct timespec *sendTime, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, ARNETWORK_Manager_DataHandle_t *handlePtr);
+
+/**
+ * @brief Get the input buffer which gave a data handle
+ * @param manager The Manager
+ * @param[in] handle handle of the data
+ * @param[out] inputBufferPtrAddr address of the pointer on the input buffer
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_GetDataHandleInputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_DataHandle_t handle, ARNETWORK_IOBuffer_t **inputBufferPtrAddr);
+
+/**
+ * @brief Read the next data of a subscriber of an output buffer without waiting
+ * @param outputBuffer the output buffer, with a broadcast ring
+ * @param[in] subscriberID identifier of the subscriber
+ * @param[out] data pointer on the data read
+ * @param[in] dataLimitSize limit size of the copy
+ * @param[out] readSize pointer to store the size of the data read ; can be equal to NULL
+ * @param[out] numberOfDataLost pointer to store the number of data lost by the subscriber
+ * @return error eARNETWORK_ERROR
+ */
+eARNETWORK_ERROR ARNETWORK_Manager_ReadSubscribedDataNoWait (ARNETWORK_IOBuffer_t *outputBuffer, int subscriberID, uint8_t *data, int dataLimitSize, int *readSize, int *numberOfDataLost);
+
 /**
  * @brief function called on disconnect
  * @param manager The networkAL manager
@@ -397,6 +439,78 @@ void* ARNETWORK_Manager_SendingThreadRun (void *data)
     return ret;
 }
 
+void* ARNETWORK_Manager_GetSendingLane (ARNETWORK_Manager_t *manager, int laneIndex)
+{
+    /** -- Gets the thread data of a sender lane -- */
+
+    /** local declarations */
+    void *lane = NULL;
+
+    /** check paratemters, the lane 0 is run by ARNETWORK_Manager_SendingThreadRun() */
+    if ((manager != NULL) && (manager->sender != NULL) && (laneIndex > 0))
+    {
+        lane = ARNETWORK_Sender_GetLane (manager->sender, laneIndex);
+    }
+
+    return lane;
+}
+
+void* ARNETWORK_Manager_SendingLaneThreadRun (void *data)
+{
+    /** -- Manage the sending of the data of a sender lane -- */
+
+    /** local declarations */
+    void *ret = NULL;
+
+    /** check paratemters */
+    if (data != NULL)
+    {
+        ret = ARNETWORK_Sender_LaneThreadRun (data);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_BAD_PARAMETER));
+    }
+
+    return ret;
+}
+
+void* ARNETWORK_Manager_GetReceivingShard (ARNETWORK_Manager_t *manager, int shardIndex)
+{
+    /** -- Gets the thread data of a receiver shard -- */
+
+    /** local declarations */
+    void *shard = NULL;
+
+    /** check paratemters, the shard 0 is run by ARNETWORK_Manager_ReceivingThreadRun() */
+    if ((manager != NULL) && (manager->receiver != NULL) && (shardIndex > 0))
+    {
+        shard = ARNETWORK_Receiver_GetShard (manager->receiver, shardIndex);
+    }
+
+    return shard;
+}
+
+void* ARNETWORK_Manager_ReceivingShardThreadRun (void *data)
+{
+    /** -- Manage the data received by the output buffers of a receiver shard -- */
+
+    /** local declarations */
+    void *ret = NULL;
+
+    /** check paratemters */
+    if (data != NULL)
+    {
+        ret = ARNETWORK_Receiver_ShardThreadRun (data);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "error: %s", ARNETWORK_Error_ToString (ARNETWORK_ERROR_BAD_PARAMETER));
+    }
+
+    return ret;
+}
+
 void* ARNETWORK_Manager_ReceivingThreadRun (void *data)
 {
     /** -- Manage the reception of the data -- */
@@ -471,269 +585,1470 @@ eARNETWORK_ERROR ARNETWORK_Manager_GetInputDataEventFd (ARNETWORK_Manager_t *man
     return managerPtr ? ARNETWORK_Receiver_GetEventFd(managerPtr->receiver, fd) : ARNETWORK_ERROR_BAD_PARAMETER;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_SendData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferWritableEventFd (ARNETWORK_Manager_t *managerPtr, int inBufferID, int *fd)
 {
-    /** -- Add data to send in a IOBuffer using fixed size data -- */
+    /** -- Get eventfd associated to the free space of an input buffer -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
-    int bufferWasEmpty = 0;
+    ARNETWORK_IOBuffer_t *buffer = NULL;
 
-    /** check paratemters:
-     *  -   the manager ponter is not NUL
-     *  -   the data pointer is not NULL
-     *  -   the callback is not NULL
-     */
-    if ((manager != NULL) && (data != NULL) && (callback != NULL))
+    if ((managerPtr == NULL) || (fd == NULL) || (inBufferID < 0) || (inBufferID >= managerPtr->networkALManager->maxIds))
     {
-        /** get the address of the inputBuffer */
-        inputBuffer = manager->inputBufferMap[inputBufferID];
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else
+    {
+        buffer = managerPtr->inputBufferMap[inBufferID];
 
-        if (inputBuffer == NULL)
+        if (buffer == NULL)
         {
             error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
     }
-    else
-    {
-        error = ARNETWORK_ERROR_BAD_PARAMETER;
-    }
 
     if (error == ARNETWORK_OK)
     {
         /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock(inputBuffer);
+        error = ARNETWORK_IOBuffer_Lock (buffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_GetWritableEventFd (buffer, fd);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (buffer);
+        }
     }
 
-    if(error == ARNETWORK_OK)
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetOutputBufferReadableEventFd (ARNETWORK_Manager_t *managerPtr, int outBufferID, int *fd)
+{
+    /** -- Get eventfd associated to the data of an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *buffer = NULL;
+
+    if ((managerPtr == NULL) || (fd == NULL) || (outBufferID < 0) || (outBufferID >= managerPtr->networkALManager->maxIds))
     {
-        bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty(inputBuffer->dataDescriptorRBuffer);
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
-
-    if(error == ARNETWORK_OK)
+    else
     {
-        /** add the data in the inputBuffer */
-        error = ARNETWORK_IOBuffer_AddData (inputBuffer, data, dataSize, customData, callback, doDataCopy);
-        ARNETWORK_IOBuffer_Unlock(inputBuffer);
+        buffer = managerPtr->outputBufferMap[outBufferID];
+
+        if (buffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
     }
 
     if (error == ARNETWORK_OK)
     {
-        if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
-            (bufferWasEmpty > 0))
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (buffer);
+
+        if (error == ARNETWORK_OK)
         {
-            ARNETWORK_Sender_SignalNewData (manager->sender);
+            error = ARNETWORK_IOBuffer_GetReadableEventFd (buffer, fd);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (buffer);
         }
     }
 
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_ReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+eARNETWORK_ERROR ARNETWORK_Manager_SendData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
 {
-    /** -- Read data received in a IOBuffer using variable size data (blocking function) -- */
+    /** -- Add data to send in a IOBuffer using fixed size data -- */
+    return ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 0, 0, NULL, customData, callback, doDataCopy, NULL);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithTimeout (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, int timeoutMs)
+{
+    /** -- Add data to send in a IOBuffer, waiting with timeout for a free cell -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    struct timespec startTime;
+    struct timespec now;
+    int remainingTimeMs = timeoutMs;
 
-    /** check paratemters */
-    if (manager != NULL)
+    ARSAL_Time_GetTime(&startTime);
+    error = ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 0, 0, NULL, customData, callback, doDataCopy, NULL);
+
+    /** the input buffer is full: wait for the sender to free a cell then try again, another producer can take it first */
+    while ((error == ARNETWORK_ERROR_BUFFER_SIZE) && (remainingTimeMs > 0))
     {
-        /** get the address of the outputBuffer */
-        outputBuffer = manager->outputBufferMap[outputBufferID];
+        inputBuffer = manager->inputBufferMap[inputBufferID];
 
-        /** check outputBuffer */
-        if (outputBuffer == NULL)
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+        if (error == ARNETWORK_OK)
         {
-            error = ARNETWORK_ERROR_ID_UNKNOWN;
+            ARNETWORK_IOBuffer_WaitWritable (inputBuffer, remainingTimeMs);
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+
+            error = ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 0, 0, NULL, customData, callback, doDataCopy, NULL);
         }
+
+        ARSAL_Time_GetTime(&now);
+        remainingTimeMs = timeoutMs - ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &now);
     }
-    else
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataV (ARNETWORK_Manager_t *manager, int inputBufferID, const struct iovec *segmentArr, int numberOfSegments, void *customData, ARNETWORK_Manager_Callback_t callback)
+{
+    /** -- Add data made of several segments to send in a IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    int bufferWasEmpty = 0;
+
+    if ((manager == NULL) || (segmentArr == NULL) || (numberOfSegments <= 0) || (callback == NULL))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
-
-    if (error == ARNETWORK_OK)
+    else if ((inputBufferID < 0) || (inputBufferID >= manager->networkALManager->maxIds) || (manager->inputBufferMap[inputBufferID] == NULL))
     {
-        /** try to take the semaphore */
-        semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
-
-        if (semError)
-        {
-            switch (errno)
-            {
-            case EAGAIN : /** no semaphore */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
-
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
-            }
-        }
+        error = ARNETWORK_ERROR_ID_UNKNOWN;
     }
-
-    /** read data */
-
-    if (error == ARNETWORK_OK)
+    else
     {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
     }
 
+    /** the segments are gathered in the data copy ; ARNetworkAL needs a contiguous data, so it is never sent inline */
     if (error == ARNETWORK_OK)
     {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+        bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty (inputBuffer->dataDescriptorRBuffer);
+        error = ARNETWORK_IOBuffer_AddDataSegments (inputBuffer, segmentArr, numberOfSegments, customData, callback);
+        ARNETWORK_IOBuffer_Unlock (inputBuffer);
 
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        if ((error == ARNETWORK_OK) &&
+            ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) || (bufferWasEmpty > 0)))
+        {
+            ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+        }
     }
 
     return error;
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_TryReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+eARNETWORK_ERROR ARNETWORK_Manager_SendBuffer (ARNETWORK_Manager_t *manager, int inputBufferID, ARNETWORK_Buffer_t *buffer, void *customData, ARNETWORK_Manager_Callback_t callback)
 {
-    /** -- try to read data received in a IOBuffer using variable size data (non-blocking function) -- */
+    /** -- Add the data of a reference-counted buffer to send in a IOBuffer -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    int bufferWasEmpty = 0;
+    int isSentInline = 0;
 
-    /** check paratemters */
-    if (manager != NULL)
+    /** the callback is optional: the buffer is released by the input buffer */
+    if ((manager == NULL) || (buffer == NULL))
     {
-        /** get the address of the outputBuffer */
-        outputBuffer = manager->outputBufferMap[outputBufferID];
-
-        /** check outputBuffer */
-        if (outputBuffer == NULL)
-        {
-            error = ARNETWORK_ERROR_ID_UNKNOWN;
-        }
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else if ((inputBufferID < 0) || (inputBufferID >= manager->networkALManager->maxIds) || (manager->inputBufferMap[inputBufferID] == NULL))
+    {
+        error = ARNETWORK_ERROR_ID_UNKNOWN;
     }
     else
     {
-        error = ARNETWORK_ERROR_BAD_PARAMETER;
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
     }
 
     if (error == ARNETWORK_OK)
     {
-        /** try to take the semaphore */
-        semError = ARSAL_Sem_Trywait (&(outputBuffer->outputSem));
+        bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty (inputBuffer->dataDescriptorRBuffer);
 
-        if (semError)
+        /** a buffer sent inline is only read during the call: the input buffer does not need a reference */
+        if ((inputBuffer->isSendingInline) && (bufferWasEmpty > 0))
         {
-            switch (errno)
-            {
-            case EAGAIN : /** no semaphore */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
+            isSentInline = ARNETWORK_Sender_TrySendInline (manager->sender, inputBuffer, ARNETWORK_Buffer_GetData (buffer), ARNETWORK_Buffer_GetSize (buffer), customData, callback, 0);
+        }
 
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
-            }
+        if (!isSentInline)
+        {
+            error = ARNETWORK_IOBuffer_AddBuffer (inputBuffer, buffer, customData, callback);
+        }
+        ARNETWORK_IOBuffer_Unlock (inputBuffer);
+
+        if ((error == ARNETWORK_OK) && (!isSentInline) &&
+            ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) || (bufferWasEmpty > 0)))
+        {
+            ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
         }
     }
 
-    /** read data */
+    return error;
+}
 
-    if (error == ARNETWORK_OK)
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithKey (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, uint32_t key, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data to send in a coalescing IOBuffer with an explicit key -- */
+    return ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 1, key, NULL, customData, callback, doDataCopy, NULL);
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataAt (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, const struct timespec *sendTime, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
+{
+    /** -- Add data to send in a IOBuffer at a given date -- */
+    if (sendTime == NULL)
     {
-        /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+        return ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
-    if (error == ARNETWORK_OK)
-    {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+    return ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 0, 0, sendTime, customData, callback, doDataCopy, NULL);
+}
 
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataWithHandle (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, ARNETWORK_Manager_DataHandle_t *handlePtr)
+{
+    /** -- Add data to send in a IOBuffer and get its handle -- */
+    if (handlePtr == NULL)
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
-    return error;
+    return ARNETWORK_Manager_AddDataToSend (manager, inputBufferID, data, dataSize, 0, 0, NULL, customData, callback, doDataCopy, handlePtr);
 }
 
-eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize, int timeoutMs)
+eARNETWORK_ERROR ARNETWORK_Manager_SendDataBatch (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_BatchData_t *batchArr, int batchSize, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
 {
-    /** -- Read, with timeout, a data received in IOBuffer using variable size data -- */
+    /** -- Add several data to send, locking each IOBuffer once -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
-    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
-    int semError = 0;
-    struct timespec semTimeout;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    ARNETWORK_IOBuffer_t *laneBufferArr[ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX] = { NULL };
+    int bufferWasEmpty = 0;
+    int isAdded = 0;
+    int batchIndex = 0;
+    int entryIndex = 0;
+    int laneIndex = 0;
 
-    /** check paratemters */
-    if (manager != NULL)
+    /** check the whole batch before adding anything */
+    if ((manager == NULL) || (batchArr == NULL) || (batchSize <= 0) || (callback == NULL))
     {
-        outputBuffer = manager->outputBufferMap[outputBufferID];
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-        /** check pOutputBuffer */
-        if (outputBuffer == NULL)
+    for (batchIndex = 0; (error == ARNETWORK_OK) && (batchIndex < batchSize); ++batchIndex)
+    {
+        if (batchArr[batchIndex].dataPtr == NULL)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else if ((batchArr[batchIndex].inputBufferID < 0) || (batchArr[batchIndex].inputBufferID >= manager->networkALManager->maxIds) ||
+                 (manager->inputBufferMap[batchArr[batchIndex].inputBufferID] == NULL))
         {
             error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
     }
+
+    if (error != ARNETWORK_OK)
+    {
+        return error;
+    }
+
+    for (batchIndex = 0; batchIndex < batchSize; ++batchIndex)
+    {
+        /** the data of an input buffer are all added with its first entry */
+        for (entryIndex = 0; (entryIndex < batchIndex) && (batchArr[entryIndex].inputBufferID != batchArr[batchIndex].inputBufferID); ++entryIndex);
+        if (entryIndex < batchIndex)
+        {
+            continue;
+        }
+
+        inputBuffer = manager->inputBufferMap[batchArr[batchIndex].inputBufferID];
+        isAdded = 0;
+
+        batchArr[batchIndex].error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+        if (batchArr[batchIndex].error == ARNETWORK_OK)
+        {
+            bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty (inputBuffer->dataDescriptorRBuffer);
+
+            for (entryIndex = batchIndex; entryIndex < batchSize; ++entryIndex)
+            {
+                if (batchArr[entryIndex].inputBufferID == batchArr[batchIndex].inputBufferID)
+                {
+                    batchArr[entryIndex].error = ARNETWORK_IOBuffer_AddData (inputBuffer, batchArr[entryIndex].dataPtr, batchArr[entryIndex].dataSize, batchArr[entryIndex].customData, callback, doDataCopy);
+                    isAdded |= (batchArr[entryIndex].error == ARNETWORK_OK) ? 1 : 0;
+                }
+            }
+
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+        else
+        {
+            for (entryIndex = batchIndex + 1; entryIndex < batchSize; ++entryIndex)
+            {
+                if (batchArr[entryIndex].inputBufferID == batchArr[batchIndex].inputBufferID)
+                {
+                    batchArr[entryIndex].error = batchArr[batchIndex].error;
+                }
+            }
+        }
+
+        /** wake up the lane of the input buffer as ARNETWORK_Manager_SendData would do */
+        if ((isAdded) && ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) || (bufferWasEmpty > 0)) &&
+            (inputBuffer->senderLane >= 0) && (inputBuffer->senderLane < manager->sender->numberOfLanes) && (inputBuffer->senderLane < ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX))
+        {
+            laneBufferArr[inputBuffer->senderLane] = inputBuffer;
+        }
+    }
+
+    /** one signal per lane for the whole batch */
+    for (laneIndex = 0; (laneIndex < manager->sender->numberOfLanes) && (laneIndex < ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX); ++laneIndex)
+    {
+        if (laneBufferArr[laneIndex] != NULL)
+        {
+            ARNETWORK_Sender_SignalNewData (manager->sender, laneBufferArr[laneIndex]);
+        }
+    }
+
+    for (batchIndex = 0; (error == ARNETWORK_OK) && (batchIndex < batchSize); ++batchIndex)
+    {
+        error = batchArr[batchIndex].error;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_CancelData (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_DataHandle_t handle)
+{
+    /** -- Cancel a data still in its input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    error = ARNETWORK_Manager_GetDataHandleInputBuffer (manager, handle, &inputBuffer);
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_CancelData (inputBuffer, handle);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** the data behind a data waiting its acknowledgement may be sent now */
+        ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReplaceData (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_DataHandle_t handle, uint8_t *data, int dataSize)
+{
+    /** -- Replace in place the content of a data still in its input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    if ((data == NULL) || (dataSize < 0))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_GetDataHandleInputBuffer (manager, handle, &inputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_ReplaceData (inputBuffer, handle, data, dataSize);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** a data waiting its acknowledgement is sent again now */
+        ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_StartPeriodicData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, int periodMs, ARNETWORK_Manager_PeriodicDataUpdate_t updateCallback, void *customData)
+{
+    /** -- Start to send a data periodically in an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    /** check paratemters:
+     *  -   the manager ponter is not NUL
+     *  -   the data pointer is not NULL and its size is not null
+     *  -   the period is positive
+     */
+    if ((manager != NULL) && (inputBufferID >= 0) && (inputBufferID < manager->networkALManager->maxIds) &&
+        (data != NULL) && (dataSize > 0) && (periodMs > 0))
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if ((inputBuffer->dataType != ARNETWORKAL_FRAME_TYPE_DATA) &&
+                 (inputBuffer->dataType != ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY))
+        {
+            /** an acknowledged data can not be repeated without waiting its acknowledgement */
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_StartPeriodicData (inputBuffer, data, dataSize, (int)(manager->networkALManager->maxBufferSize - offsetof (ARNETWORKAL_Frame_t, dataPtr)), periodMs, updateCallback, customData);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** wake up the sender to schedule the periodic data */
+        ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_UpdatePeriodicData (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize)
+{
+    /** -- Update the periodic data of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    if ((manager != NULL) && (inputBufferID >= 0) && (inputBufferID < manager->networkALManager->maxIds) &&
+        (data != NULL) && (dataSize > 0))
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_UpdatePeriodicData (inputBuffer, data, dataSize);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_StopPeriodicData (ARNETWORK_Manager_t *manager, int inputBufferID)
+{
+    /** -- Stop to send the periodic data of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+
+    if ((manager != NULL) && (inputBufferID >= 0) && (inputBufferID < manager->networkALManager->maxIds))
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (inputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_IOBuffer_StopPeriodicData (inputBuffer);
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (inputBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+{
+    /** -- Read data received in a IOBuffer using variable size data (blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore */
+        semError = ARSAL_Sem_Wait (&(outputBuffer->outputSem));
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+        /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+
+        /** the data is still to read: give back the semaphore */
+        if (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED)
+        {
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_TryReadData (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+{
+    /** -- try to read data received in a IOBuffer using variable size data (non-blocking function) -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        /** get the address of the outputBuffer */
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** try to take the semaphore */
+        semError = ARSAL_Sem_Trywait (&(outputBuffer->outputSem));
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+        /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+
+        /** the data is still to read: give back the semaphore */
+        if (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED)
+        {
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataWithTimeout (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize, int timeoutMs)
+{
+    /** -- Read, with timeout, a data received in IOBuffer using variable size data -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check pOutputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** convert timeoutMs in timespec */
+        semTimeout.tv_sec = timeoutMs / 1000;
+        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+        /** try to take the semaphore with timeout*/
+        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    /** read data */
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+
+        /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+
+        /** the data is still to read: give back the semaphore */
+        if (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED)
+        {
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBatch (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, ARNETWORK_Manager_ReadSlice_t *sliceArr, int maxNumberOfSlices, int *numberOfSlicesPtr, int timeoutMs, int accumulationTimeUs)
+{
+    /** -- Read, with timeout, several data received in IOBuffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+    struct timespec startTime;
+    struct timespec now;
+    int64_t remainingTimeUs = 0;
+    int numberOfSemTaken = 0;
+    int numberOfSlices = 0;
+
+    /** check paratemters */
+    if ((manager != NULL) && (data != NULL) && (dataLimitSize >= 0) && (sliceArr != NULL) && (maxNumberOfSlices > 0) && (numberOfSlicesPtr != NULL) &&
+        (timeoutMs >= 0) && (accumulationTimeUs >= 0))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** convert timeoutMs in timespec */
+        semTimeout.tv_sec = timeoutMs / 1000;
+        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+        /** wait the first data */
+        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+        else
+        {
+            numberOfSemTaken = 1;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** take the data already received, then wait the next ones until the end of the accumulation time */
+        ARSAL_Time_GetTime (&startTime);
+        while (numberOfSemTaken < maxNumberOfSlices)
+        {
+            if (ARSAL_Sem_Trywait (&(outputBuffer->outputSem)) == 0)
+            {
+                numberOfSemTaken++;
+                continue;
+            }
+
+            ARSAL_Time_GetTime (&now);
+            remainingTimeUs = accumulationTimeUs - (((int64_t) (now.tv_sec - startTime.tv_sec) * 1000000) + ((now.tv_nsec - startTime.tv_nsec) / 1000));
+            if (remainingTimeUs <= 0)
+            {
+                break;
+            }
+
+            semTimeout.tv_sec = remainingTimeUs / 1000000;
+            semTimeout.tv_nsec = (remainingTimeUs % 1000000) * 1000;
+            if (ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout) != 0)
+            {
+                break;
+            }
+            numberOfSemTaken++;
+        }
+
+        /** read all the data in one lock of the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReadDataBatch (outputBuffer, data, dataLimitSize, sliceArr, numberOfSemTaken, &numberOfSlices);
+
+        /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    /** give back the semaphores of the data not read */
+    for (; numberOfSemTaken > numberOfSlices; numberOfSemTaken--)
+    {
+        ARSAL_Sem_Post (&(outputBuffer->outputSem));
+    }
+
+    if (numberOfSlicesPtr != NULL)
+    {
+        *numberOfSlicesPtr = numberOfSlices;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataBorrow (ARNETWORK_Manager_t *manager, int outputBufferID, const uint8_t **dataPtrAddr, int *dataSizePtr, int timeoutMs)
+{
+    /** -- Borrow, with timeout, a data received in IOBuffer without copying it -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int semError = 0;
+    struct timespec semTimeout;
+
+    /** check paratemters */
+    if ((manager != NULL) && (dataPtrAddr != NULL) && (dataSizePtr != NULL) && (timeoutMs >= 0))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** convert timeoutMs in timespec */
+        semTimeout.tv_sec = timeoutMs / 1000;
+        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+
+        /** try to take the semaphore with timeout*/
+        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+
+        if (semError)
+        {
+            switch (errno)
+            {
+            case ETIMEDOUT : /** semaphore time out */
+            case EAGAIN : /** no semaphore */
+                error = ARNETWORK_ERROR_BUFFER_EMPTY;
+                break;
+
+            default:
+                error = ARNETWORK_ERROR_SEMAPHORE;
+                break;
+            }
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_BorrowData (outputBuffer, dataPtrAddr, dataSizePtr);
+
+        /** unlock the IOBuffer ; the borrowed data is kept until it is released */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+
+        /** the data is still to read: give back the semaphore */
+        if (error == ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED)
+        {
+            ARSAL_Sem_Post (&(outputBuffer->outputSem));
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadDataRelease (ARNETWORK_Manager_t *manager, int outputBufferID)
+{
+    /** -- Release a data borrowed with ARNETWORK_Manager_ReadDataBorrow -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if (manager != NULL)
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_ReleaseData (outputBuffer);
+
+        /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadLatest (ARNETWORK_Manager_t *manager, int outputBufferID, uint8_t *data, int dataLimitSize, int *readSize)
+{
+    /** -- Read the newest data received in IOBuffer, discarding the older ones -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int numberOfDataPopped = 0;
+
+    /** check paratemters */
+    if ((manager != NULL) && (data != NULL) && (dataLimitSize >= 0) && (outputBufferID >= 0) && (outputBufferID < manager->networkALManager->maxIds))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if ((error == ARNETWORK_OK) && (outputBuffer->isLatestOnly))
+    {
+        /** the slot of the latest data is read without lock: the receiving thread is never blocked */
+        error = ARNETWORK_IOBuffer_ReadLatestData (outputBuffer, data, dataLimitSize, readSize);
+    }
+    else if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_IOBuffer_ReadNewestData (outputBuffer, data, dataLimitSize, readSize, &numberOfDataPopped);
+
+            /** take the semaphores of the data popped ; those already taken by a waiting reader, which will find the buffer empty, are missing */
+            while ((numberOfDataPopped > 0) && (ARSAL_Sem_Trywait (&(outputBuffer->outputSem)) == 0))
+            {
+                numberOfDataPopped--;
+            }
+
+            /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+            if (error == ARNETWORK_OK)
+            {
+                ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, outputBuffer);
+            }
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SubscribeOutputBuffer (ARNETWORK_Manager_t *manager, int outputBufferID, int *subscriberID)
+{
+    /** -- Subscribe to the data received by an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager != NULL) && (subscriberID != NULL) && (outputBufferID >= 0) && (outputBufferID < manager->networkALManager->maxIds))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if (outputBuffer->broadcastRing == NULL)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_BroadcastRing_Subscribe (outputBuffer->broadcastRing, subscriberID);
+
+            ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_UnsubscribeOutputBuffer (ARNETWORK_Manager_t *manager, int outputBufferID, int subscriberID)
+{
+    /** -- Unsubscribe from the data received by an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager != NULL) && (outputBufferID >= 0) && (outputBufferID < manager->networkALManager->maxIds))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if (outputBuffer->broadcastRing == NULL)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_BroadcastRing_Unsubscribe (outputBuffer->broadcastRing, subscriberID);
+
+            ARNETWORK_IOBuffer_Unlock (outputBuffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadSubscribedData (ARNETWORK_Manager_t *manager, int outputBufferID, int subscriberID, uint8_t *data, int dataLimitSize, int *readSize, int *numberOfDataLost, int timeoutMs)
+{
+    /** -- Read the next data received by an output buffer for one of its subscribers -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+    int numberOfDataLostRead = 0;
+    int totalNumberOfDataLost = 0;
+
+    /** check paratemters */
+    if ((manager != NULL) && (data != NULL) && (dataLimitSize >= 0) && (timeoutMs >= 0) && (outputBufferID >= 0) && (outputBufferID < manager->networkALManager->maxIds))
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+        else if (outputBuffer->broadcastRing == NULL)
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_Manager_ReadSubscribedDataNoWait (outputBuffer, subscriberID, data, dataLimitSize, readSize, &totalNumberOfDataLost);
+    }
+
+    /** read once more after waiting if the subscriber read all the data */
+    if ((error == ARNETWORK_ERROR_BUFFER_EMPTY) && (timeoutMs > 0))
+    {
+        error = ARNETWORK_Receiver_WaitSubscribedData (manager->receiver, outputBuffer, subscriberID, timeoutMs);
+
+        if (error == ARNETWORK_OK)
+        {
+            error = ARNETWORK_Manager_ReadSubscribedDataNoWait (outputBuffer, subscriberID, data, dataLimitSize, readSize, &numberOfDataLostRead);
+            totalNumberOfDataLost += numberOfDataLostRead;
+        }
+    }
+
+    if (numberOfDataLost != NULL)
+    {
+        *numberOfDataLost = totalNumberOfDataLost;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_ReadSubscribedDataNoWait (ARNETWORK_IOBuffer_t *outputBuffer, int subscriberID, uint8_t *data, int dataLimitSize, int *readSize, int *numberOfDataLost)
+{
+    /** -- Read the next data of a subscriber without waiting -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    /** the mutex is only held for the copy: the receiving thread never waits for a slow subscriber */
+    error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+
+    if (error == ARNETWORK_OK)
+    {
+        error = ARNETWORK_BroadcastRing_Read (outputBuffer->broadcastRing, subscriberID, data, dataLimitSize, readSize, numberOfDataLost);
+
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_SetOutputBufferHandler (ARNETWORK_Manager_t *manager, int outputBufferID, ARNETWORK_Manager_OutputHandler_t handler, void *customData)
+{
+    /** -- Set the handler of the data received by an output buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBuffer = NULL;
+
+    /** check paratemters */
+    if ((manager == NULL) || (outputBufferID < 0) || (outputBufferID >= manager->networkALManager->maxIds))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
     else
+    {
+        outputBuffer = manager->outputBufferMap[outputBufferID];
+
+        /** check outputBuffer */
+        if (outputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer: the receiver calls the handler with the IOBuffer locked */
+        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        outputBuffer->outputHandler = handler;
+        outputBuffer->outputHandlerCustomData = customData;
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_WaitAny (ARNETWORK_Manager_t *manager, const int *outputBufferIDArr, int numberOfOutputBuffers, int timeoutMs, uint32_t *readyMaskPtr)
+{
+    /** -- Wait until at least one of several output buffers has a data to read -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *outputBufferPtrArr[ARNETWORK_MANAGER_WAITANY_MAX];
+    int bufferIndex = 0;
+
+    /** check paratemters */
+    if ((manager == NULL) || (outputBufferIDArr == NULL) || (readyMaskPtr == NULL) ||
+        (numberOfOutputBuffers <= 0) || (numberOfOutputBuffers > ARNETWORK_MANAGER_WAITANY_MAX) || (timeoutMs < 0))
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
     }
 
+    for (bufferIndex = 0; (error == ARNETWORK_OK) && (bufferIndex < numberOfOutputBuffers); ++bufferIndex)
+    {
+        if ((outputBufferIDArr[bufferIndex] < 0) || (outputBufferIDArr[bufferIndex] >= manager->networkALManager->maxIds))
+        {
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else
+        {
+            outputBufferPtrArr[bufferIndex] = manager->outputBufferMap[outputBufferIDArr[bufferIndex]];
+
+            /** check outputBuffer */
+            if (outputBufferPtrArr[bufferIndex] == NULL)
+            {
+                error = ARNETWORK_ERROR_ID_UNKNOWN;
+            }
+        }
+    }
+
     if (error == ARNETWORK_OK)
     {
-        /** convert timeoutMs in timespec */
-        semTimeout.tv_sec = timeoutMs / 1000;
-        semTimeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+        error = ARNETWORK_Receiver_WaitReadable (manager->receiver, outputBufferPtrArr, numberOfOutputBuffers, timeoutMs, readyMaskPtr);
+    }
 
-        /** try to take the semaphore with timeout*/
-        semError = ARSAL_Sem_Timedwait (&(outputBuffer->outputSem), &semTimeout);
+    return error;
+}
 
-        if (semError)
-        {
-            switch (errno)
-            {
-            case ETIMEDOUT : /** semaphore time out */
-                error = ARNETWORK_ERROR_BUFFER_EMPTY;
-                break;
+/*****************************************
+ *
+ *             private implementation:
+ *
+ *****************************************/
 
-            default:
-                error = ARNETWORK_ERROR_SEMAPHORE;
-                break;
-            }
+eARNETWORK_ERROR ARNETWORK_Manager_AddDataToSend (ARNETWORK_Manager_t *manager, int inputBufferID, uint8_t *data, int dataSize, int hasKey, uint32_t key, const struct timespec *sendTime, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy, ARNETWORK_Manager_DataHandle_t *handlePtr)
+{
+    /** -- Add data to send in a IOBuffer and wake up the sender if needed -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *inputBuffer = NULL;
+    int bufferWasEmpty = 0;
+    int isSentInline = 0;
+    uint32_t handle = 0;
+
+    /** check paratemters:
+     *  -   the manager ponter is not NUL
+     *  -   the data pointer is not NULL
+     *  -   the callback is not NULL
+     */
+    if ((manager != NULL) && (data != NULL) && (callback != NULL))
+    {
+        /** get the address of the inputBuffer */
+        inputBuffer = manager->inputBufferMap[inputBufferID];
+
+        if (inputBuffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
         }
     }
+    else
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
 
-    /** read data */
+    if ((error == ARNETWORK_OK) && (inputBuffer->isLockFree) && (!hasKey) && (sendTime == NULL) && (handlePtr == NULL))
+    {
+        /** add the data without locking the IOBuffer ; the sender gets it when it locks the IOBuffer */
+        error = ARNETWORK_IOBuffer_AddDataLockFree (inputBuffer, data, dataSize, customData, callback, doDataCopy, &bufferWasEmpty);
+
+        if ((error == ARNETWORK_OK) &&
+            ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) || (bufferWasEmpty > 0)))
+        {
+            ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+        }
+
+        return error;
+    }
 
     if (error == ARNETWORK_OK)
     {
         /** lock the IOBuffer */
-        error = ARNETWORK_IOBuffer_Lock (outputBuffer);
+        error = ARNETWORK_IOBuffer_Lock(inputBuffer);
     }
 
-    if (error == ARNETWORK_OK)
+    if(error == ARNETWORK_OK)
     {
-        error = ARNETWORK_IOBuffer_ReadData (outputBuffer, data, dataLimitSize, readSize);
+        bufferWasEmpty = ARNETWORK_RingBuffer_IsEmpty(inputBuffer->dataDescriptorRBuffer);
+        if (handlePtr != NULL)
+        {
+            handle = ARNETWORK_IOBuffer_NewDataHandle(inputBuffer);
+        }
+    }
 
-        /** unlock the IOBuffer */
-        ARNETWORK_IOBuffer_Unlock (outputBuffer);
+    if ((error == ARNETWORK_OK) && (inputBuffer->isSendingInline) && (bufferWasEmpty > 0) && (sendTime == NULL))
+    {
+        /** send the data from this thread if possible */
+        isSentInline = ARNETWORK_Sender_TrySendInline (manager->sender, inputBuffer, data, dataSize, customData, callback, doDataCopy);
+    }
+
+    if(error == ARNETWORK_OK)
+    {
+        /** add the data in the inputBuffer */
+        if (isSentInline)
+        {
+            /** the data is already sent */
+        }
+        else if (hasKey)
+        {
+            error = ARNETWORK_IOBuffer_AddDataWithKey (inputBuffer, data, dataSize, key, handle, customData, callback, doDataCopy);
+        }
+        else
+        {
+            error = ARNETWORK_IOBuffer_AddDataAt (inputBuffer, data, dataSize, sendTime, handle, customData, callback, doDataCopy);
+        }
+        ARNETWORK_IOBuffer_Unlock(inputBuffer);
+    }
+
+    if ((error == ARNETWORK_OK) && (handlePtr != NULL))
+    {
+        /** a data sent inline is not found by its handle anymore */
+        *handlePtr = handle;
+    }
+
+    if ((error == ARNETWORK_OK) && (!isSentInline))
+    {
+        if ((inputBuffer->dataType == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
+            (bufferWasEmpty > 0))
+        {
+            ARNETWORK_Sender_SignalNewData (manager->sender, inputBuffer);
+        }
     }
 
     return error;
 }
 
-/*****************************************
- *
- *             private implementation:
- *
- *****************************************/
+eARNETWORK_ERROR ARNETWORK_Manager_GetDataHandleInputBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_Manager_DataHandle_t handle, ARNETWORK_IOBuffer_t **inputBufferPtrAddr)
+{
+    /** -- Get the input buffer which gave a data handle -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int inputBufferID = ARNETWORK_IOBUFFER_DATA_HANDLE_ID (handle);
+
+    if ((manager == NULL) || (handle == ARNETWORK_MANAGER_DATA_HANDLE_INVALID) || (inputBufferID >= manager->networkALManager->maxIds))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else if (manager->inputBufferMap[inputBufferID] == NULL)
+    {
+        error = ARNETWORK_ERROR_ID_UNKNOWN;
+    }
+    else
+    {
+        *inputBufferPtrAddr = manager->inputBufferMap[inputBufferID];
+    }
+
+    return error;
+}
 
 eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager, ARNETWORK_IOBufferParam_t *inputParamArray, ARNETWORK_IOBufferParam_t *outputParamArray)
 {
@@ -752,7 +2067,8 @@ eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager,
     ARNETWORK_IOBufferParam_DefaultInit (&paramNewACK);
     paramNewACK.dataType = ARNETWORKAL_FRAME_TYPE_ACK;
     paramNewACK.numberOfCell = 1;
-    paramNewACK.dataCopyMaxSize = sizeof (( (ARNETWORKAL_Frame_t *)NULL)->seq);
+    /** sequence number, followed by the number of free cells of a flow-controlled output buffer */
+    paramNewACK.dataCopyMaxSize = sizeof (( (ARNETWORKAL_Frame_t *)NULL)->seq) + sizeof (uint8_t);
     paramNewACK.isOverwriting = 0;
 
     /** Initialize the ping buffers parameters */
@@ -819,14 +2135,51 @@ eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager,
         /** check parameters */
         /** -   all output buffer must have the ability to copy */
         /** -   id must be within range ]ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX; ackIdOffset] */
+        /** -   coalescing and lock-free adding are only available on input buffers */
+        /** -   receiverShard must index a receiver shard */
+        /** -   flow control is only available on acknowledged buffers which do not overwrite their data */
+        /** -   the subscribers must fit in the subscriber table, and do not read latest only buffers */
         if ((outputParamArray[outputIndex].ID >= (manager->networkALManager->maxIds / 2)) ||
             (outputParamArray[outputIndex].ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX) ||
-            (outputParamArray[outputIndex].dataCopyMaxSize == 0))
+            (outputParamArray[outputIndex].dataCopyMaxSize == 0) ||
+            (outputParamArray[outputIndex].coalescingKeySize != 0) ||
+            (outputParamArray[outputIndex].isLockFree != 0) ||
+            (outputParamArray[outputIndex].receiverShard < 0) ||
+            (outputParamArray[outputIndex].receiverShard >= ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX) ||
+            ((outputParamArray[outputIndex].isFlowControlled != 0) &&
+             ((outputParamArray[outputIndex].dataType != ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK) || (outputParamArray[outputIndex].isOverwriting != 0))) ||
+            (outputParamArray[outputIndex].maxNumberOfSubscribers < 0) ||
+            (outputParamArray[outputIndex].maxNumberOfSubscribers > ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX) ||
+            ((outputParamArray[outputIndex].maxNumberOfSubscribers != 0) && (outputParamArray[outputIndex].isLatestOnly != 0)))
         {
             if (outputParamArray[outputIndex].dataCopyMaxSize == 0)
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].dataCopyMaxSize == 0", outputIndex);
             }
+            else if (outputParamArray[outputIndex].coalescingKeySize != 0)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].coalescingKeySize != 0 ; coalescing is only available on input buffers", outputIndex);
+            }
+            else if (outputParamArray[outputIndex].isLockFree != 0)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].isLockFree != 0 ; lock-free adding is only available on input buffers", outputIndex);
+            }
+            else if ((outputParamArray[outputIndex].receiverShard < 0) || (outputParamArray[outputIndex].receiverShard >= ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX))
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].receiverShard (%d) is not in the range [0; %d[", outputIndex, outputParamArray[outputIndex].receiverShard, ARNETWORK_IOBUFFERPARAM_RECEIVERSHARD_MAX);
+            }
+            else if (outputParamArray[outputIndex].isFlowControlled != 0)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].isFlowControlled != 0 ; flow control is only available on ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK buffers which do not overwrite their data", outputIndex);
+            }
+            else if ((outputParamArray[outputIndex].maxNumberOfSubscribers < 0) || (outputParamArray[outputIndex].maxNumberOfSubscribers > ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX))
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].maxNumberOfSubscribers (%d) is not in the range [0; %d]", outputIndex, outputParamArray[outputIndex].maxNumberOfSubscribers, ARNETWORK_IOBUFFERPARAM_SUBSCRIBERS_MAX);
+            }
+            else if (outputParamArray[outputIndex].maxNumberOfSubscribers != 0)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d].maxNumberOfSubscribers != 0 ; subscribers are not available on latest only buffers", outputIndex);
+            }
             else
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "outputParamArray[%d] has a bad ID (%d). The ID should be in the range : ]%d; %d]", outputIndex, outputParamArray[outputIndex].ID, ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX, (manager->networkALManager->maxIds / 2));
@@ -891,11 +2244,43 @@ eARNETWORK_ERROR ARNETWORK_Manager_CreateIOBuffer (ARNETWORK_Manager_t *manager,
         /** check parameters: */
         /** -   id is smaller than the id acknowledge offset */
         /** -   dataCopyMaxSize isn't too big */
+        /** -   senderLane must index a sender lane */
+        /** -   coalescingKeySize fits in a coalescing key */
+        /** -   isSendingInline is only set on data and low latency data buffers */
+        /** -   isLatestOnly and maxNumberOfSubscribers are only set on output buffers */
+        /** -   isLockFree is not set with isOverwriting, coalescingKeySize or isSendingInline */
         if ((inputParamArray[inputIndex].ID >= (manager->networkALManager->maxIds / 2)) ||
             (inputParamArray[inputIndex].ID <  ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX))
         {
             error = ARNETWORK_ERROR_BAD_PARAMETER;
         }
+        else if ((inputParamArray[inputIndex].senderLane < 0) || (inputParamArray[inputIndex].senderLane >= ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "inputParamArray[%d].senderLane (%d) is not in the range [0; %d[", inputIndex, inputParamArray[inputIndex].senderLane, ARNETWORK_IOBUFFERPARAM_SENDERLANE_MAX);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else if ((inputParamArray[inputIndex].coalescingKeySize < 0) || (inputParamArray[inputIndex].coalescingKeySize > ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "inputParamArray[%d].coalescingKeySize (%d) is not in the range [0; %d]", inputIndex, inputParamArray[inputIndex].coalescingKeySize, ARNETWORK_IOBUFFERPARAM_COALESCINGKEYSIZE_MAX);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else if ((inputParamArray[inputIndex].isSendingInline) &&
+                 (inputParamArray[inputIndex].dataType != ARNETWORKAL_FRAME_TYPE_DATA) && (inputParamArray[inputIndex].dataType != ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "inputParamArray[%d].isSendingInline is set on a buffer of dataType %d", inputIndex, inputParamArray[inputIndex].dataType);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else if ((inputParamArray[inputIndex].isLatestOnly != 0) || (inputParamArray[inputIndex].maxNumberOfSubscribers != 0))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "inputParamArray[%d].isLatestOnly or maxNumberOfSubscribers is set ; they are only available on output buffers", inputIndex);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
+        else if ((inputParamArray[inputIndex].isLockFree) &&
+                 ((inputParamArray[inputIndex].isOverwriting) || (inputParamArray[inputIndex].coalescingKeySize != 0) || (inputParamArray[inputIndex].isSendingInline)))
+        {
+            ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_MANAGER_TAG, "inputParamArray[%d].isLockFree is set with isOverwriting, coalescingKeySize or isSendingInline ; they need the lock of the buffer", inputIndex);
+            error = ARNETWORK_ERROR_BAD_PARAMETER;
+        }
 
         /** Check for special (negative) values for dataCopyMaxSize. */
         if (inputParamArray[inputIndex].dataCopyMaxSize < 0)
@@ -992,6 +2377,12 @@ eARNETWORK_ERROR ARNETWORK_Manager_FlushOutputBuffer (ARNETWORK_Manager_t *manag
                 /** flush the IOBuffer*/
                 error = ARNETWORK_IOBuffer_Flush (buffer);
 
+                /** a flow-controlled output buffer which advertised it was full advertises its free cells */
+                if (error == ARNETWORK_OK)
+                {
+                    ARNETWORK_Receiver_UpdateFlowControl (manager->receiver, buffer);
+                }
+
                 /** unlock the IOBuffer */
                 ARNETWORK_IOBuffer_Unlock (buffer);
             }
@@ -1060,6 +2451,109 @@ int ARNETWORK_Manager_GetEstimatedMissPercentage (ARNETWORK_Manager_t *manager,
     }
 }
 
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferQueueState (ARNETWORK_Manager_t *manager, int inBufferID, int *numberOfData, int *numberOfFreeCells, int *drainTimeMs)
+{
+    /** -- Gets the state of the queue of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *buffer = NULL;
+    int roundTripTimeMs = -1;
+
+    if ((manager == NULL) || (inBufferID < 0) || (inBufferID >= manager->networkALManager->maxIds))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else
+    {
+        buffer = manager->inputBufferMap[inBufferID];
+
+        if (buffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+
+    if ((error == ARNETWORK_OK) && (drainTimeMs != NULL))
+    {
+        /** the ping mutex is not taken with the IOBuffer locked */
+        roundTripTimeMs = ARNETWORK_Sender_GetPing (manager->sender);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (buffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            if (numberOfData != NULL)
+            {
+                *numberOfData = ARNETWORK_IOBuffer_GetNumberOfData (buffer);
+            }
+            if (numberOfFreeCells != NULL)
+            {
+                *numberOfFreeCells = ARNETWORK_IOBuffer_GetNumberOfFreeCells (buffer);
+            }
+            if (drainTimeMs != NULL)
+            {
+                *drainTimeMs = ARNETWORK_IOBuffer_GetEstimatedDrainTimeMs (buffer, roundTripTimeMs);
+            }
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (buffer);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetInputBufferOverflowStats (ARNETWORK_Manager_t *manager, int inBufferID, uint32_t *overflowCount, uint32_t *dropCount)
+{
+    /** -- Gets the ARNetworkAL overflow counters of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_IOBuffer_t *buffer = NULL;
+
+    if ((manager == NULL) || (inBufferID < 0) || (inBufferID >= manager->networkALManager->maxIds))
+    {
+        error = ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    else
+    {
+        buffer = manager->inputBufferMap[inBufferID];
+
+        if (buffer == NULL)
+        {
+            error = ARNETWORK_ERROR_ID_UNKNOWN;
+        }
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /** lock the IOBuffer */
+        error = ARNETWORK_IOBuffer_Lock (buffer);
+
+        if (error == ARNETWORK_OK)
+        {
+            if (overflowCount != NULL)
+            {
+                *overflowCount = buffer->nbOverflows;
+            }
+            if (dropCount != NULL)
+            {
+                *dropCount = buffer->nbDrops;
+            }
+
+            /** unlock the IOBuffer */
+            ARNETWORK_IOBuffer_Unlock (buffer);
+        }
+    }
+
+    return error;
+}
+
 eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager_t *manager, int minimumTimeMs)
 {
     if ((manager == NULL) ||
@@ -1071,6 +2565,39 @@ eARNETWORK_ERROR ARNETWORK_Manager_SetMinimumTimeBetweenSends (ARNETWORK_Manager
     return ARNETWORK_OK;
 }
 
+eARNETWORK_ERROR ARNETWORK_Manager_SetSendCoalescingWindow (ARNETWORK_Manager_t *manager, int windowUs)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL) ||
+        (windowUs < 0))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    manager->sender->sendCoalescingWindowUs = windowUs;
+    return ARNETWORK_OK;
+}
+
+eARNETWORK_ERROR ARNETWORK_Manager_GetSenderStats (ARNETWORK_Manager_t *manager, uint32_t *framesCount, uint32_t *sendsCount)
+{
+    if ((manager == NULL) ||
+        (manager->sender == NULL))
+    {
+        return ARNETWORK_ERROR_BAD_PARAMETER;
+    }
+    /** the counters are updated with the ARNetworkAL mutex locked, by the lanes and the threads sending inline */
+    ARSAL_Mutex_Lock (&(manager->sender->networkALMutex));
+    if (framesCount != NULL)
+    {
+        *framesCount = manager->sender->nbFramesPushed;
+    }
+    if (sendsCount != NULL)
+    {
+        *sendsCount = manager->sender->nbSends;
+    }
+    ARSAL_Mutex_Unlock (&(manager->sender->networkALMutex));
+    return ARNETWORK_OK;
+}
+
 void ARNETWORK_Manager_OnDisconnect (ARNETWORKAL_Manager_t *alManager, void *customData)
 {
     /* -- function called on disconnect -- */
@@ -56,6 +56,7 @@
 #include <libARSAL/ARSAL_Print.h>
 #include <libARSAL/ARSAL_Mutex.h>
 #include <libARSAL/ARSAL_Sem.h>
+#include <libARSAL/ARSAL_Time.h>
 #include <libARSAL/ARSAL_Socket.h>
 #include <libARSAL/ARSAL_Endianness.h>
 
@@ -84,15 +85,56 @@
  *****************************************/
 
 /**
- * @brief copy the data received to the output buffer
- * @param receiverPtr the pointer on the receiver
+ * @brief copy the data received to the output buffer, or give it to the handler of the output buffer
+ * @param shardPtr the pointer on the receiver shard of the output buffer
  * @param outputBufferPtr[in] pointer on the output buffer
  * @param framePtr[in] pointer on the frame received
  * @return eARNETWORK_ERROR.
- * @pre only call by ARNETWORK_Sender_ThreadRun()
- * @see ARNETWORK_Sender_ThreadRun()
+ * @pre only call by ARNETWORK_Receiver_ProcessDataFrame()
+ * @see ARNETWORK_Receiver_ProcessDataFrame()
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_ReceiverShard_t *shardPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr);
+
+/**
+ * @brief give a data frame to its output buffer, and return an acknowledgement if the frame is a data with acknowledgement
+ * @param shardPtr the pointer on the receiver shard of the output buffer
+ * @param outputBufferPtr[in] pointer on the output buffer
+ * @param framePtr[in] pointer on the frame received
+ * @pre only call by the thread processing the shard
+ */
+void ARNETWORK_Receiver_ProcessDataFrame (ARNETWORK_ReceiverShard_t *shardPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr);
+
+/**
+ * @brief process a data frame in the receiving thread, or copy it in the queue of the receiver shard of its output buffer
+ * @param receiverPtr the pointer on the receiver
+ * @param framePtr[in] pointer on the frame received
+ * @pre only call by ARNETWORK_Receiver_ThreadRun()
+ */
+void ARNETWORK_Receiver_DispatchDataFrame (ARNETWORK_Receiver_t *receiverPtr, ARNETWORKAL_Frame_t *framePtr);
+
+/**
+ * @brief notify the consumers of the data added in the output buffers by a batch of frames
+ * @details the eventfd of the receiver is written once per batch, and the threads waiting readableCond are woken up.
+ * @param shardPtr the pointer on the receiver shard which processed the batch
+ * @pre only call by the thread processing the shard
  */
-eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr);
+void ARNETWORK_Receiver_NotifyDataReceived (ARNETWORK_ReceiverShard_t *shardPtr);
+
+/**
+ * @brief get the mask of the output buffers with a data to read
+ * @param outputBufferPtrArr the output buffers
+ * @param[in] numberOfOutputBuffers number of output buffers in outputBufferPtrArr
+ * @return mask of the output buffers with a data to read: bit i for outputBufferPtrArr[i]
+ */
+uint32_t ARNETWORK_Receiver_GetReadyMask (ARNETWORK_IOBuffer_t **outputBufferPtrArr, int numberOfOutputBuffers);
+
+/**
+ * @brief check if a subscriber of the output buffer has a data to read
+ * @param outputBufferPtr the output buffer, with a broadcast ring
+ * @param[in] subscriberID identifier of the subscriber
+ * @return 1 if the subscriber has a data to read, otherwise 0
+ */
+int ARNETWORK_Receiver_SubscriberHasData (ARNETWORK_IOBuffer_t *outputBufferPtr, int subscriberID);
 
 /*****************************************
  *
@@ -107,7 +149,11 @@ ARNETWORK_Receiver_t* ARNETWORK_Receiver_New (ARNETWORKAL_Manager_t *networkALMa
 
     /** local declarations */
     ARNETWORK_Receiver_t *receiverPtr = NULL;
+    ARNETWORK_ReceiverShard_t *shardPtr = NULL;
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    unsigned int outputBufferIndex = 0;
+    int shardIndex = 0;
+    int numberOfCell = 0;
 
     /** Create the receiver */
     receiverPtr =  malloc (sizeof (ARNETWORK_Receiver_t));
@@ -132,9 +178,79 @@ ARNETWORK_Receiver_t* ARNETWORK_Receiver_New (ARNETWORKAL_Manager_t *networkALMa
             receiverPtr->outputBufferPtrArr = outputBufferPtrArr;
 
             receiverPtr->outputBufferPtrMap = outputBufferPtrMap;
+            receiverPtr->readableWaitersCount = 0;
+
+            if ((ARSAL_Mutex_Init (&(receiverPtr->readableMutex)) != 0) ||
+                (ARSAL_Cond_Init (&(receiverPtr->readableCond)) != 0))
+            {
+                error = ARNETWORK_ERROR_MUTEX;
+            }
 #ifdef ENABLE_MONITOR_INCOMING_DATA
             receiverPtr->inputEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 #endif
+
+            /** one shard per shard index used by the output buffers, the shard 0 always exists */
+            receiverPtr->numberOfShards = 1;
+            for (outputBufferIndex = 0; outputBufferIndex < numberOfOutputBuff; ++outputBufferIndex)
+            {
+                if (outputBufferPtrArr[outputBufferIndex]->receiverShard >= receiverPtr->numberOfShards)
+                {
+                    receiverPtr->numberOfShards = outputBufferPtrArr[outputBufferIndex]->receiverShard + 1;
+                }
+            }
+        }
+        else
+        {
+            receiverPtr->numberOfShards = 0;
+        }
+
+        /* Create the shards */
+        receiverPtr->shardArr = NULL;
+        if (error == ARNETWORK_OK)
+        {
+            receiverPtr->shardArr = calloc (receiverPtr->numberOfShards, sizeof (ARNETWORK_ReceiverShard_t));
+            if (receiverPtr->shardArr == NULL)
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+
+        for (shardIndex = 0; (error == ARNETWORK_OK) && (shardIndex < receiverPtr->numberOfShards); ++shardIndex)
+        {
+            shardPtr = &(receiverPtr->shardArr[shardIndex]);
+            shardPtr->receiverPtr = receiverPtr;
+            shardPtr->index = shardIndex;
+
+            /* Create the mutex/condition */
+            if ((ARSAL_Mutex_Init (&(shardPtr->newFramesMutex)) != 0) ||
+                (ARSAL_Cond_Init (&(shardPtr->newFramesCond)) != 0))
+            {
+                error = ARNETWORK_ERROR_MUTEX;
+            }
+
+            /** the queue of a shard above 0 can hold as many frames as its output buffers, each frame with the largest data of its output buffers */
+            numberOfCell = 0;
+            for (outputBufferIndex = 0; (shardIndex > 0) && (outputBufferIndex < numberOfOutputBuff); ++outputBufferIndex)
+            {
+                if ((outputBufferPtrArr[outputBufferIndex]->receiverShard == shardIndex) &&
+                    (ARNETWORK_IOBuffer_GetDataMaxSize (outputBufferPtrArr[outputBufferIndex]) > 0))
+                {
+                    numberOfCell += outputBufferPtrArr[outputBufferIndex]->dataDescriptorRBuffer->numberOfCell;
+                    if (ARNETWORK_IOBuffer_GetDataMaxSize (outputBufferPtrArr[outputBufferIndex]) > shardPtr->maxDataSize)
+                    {
+                        shardPtr->maxDataSize = ARNETWORK_IOBuffer_GetDataMaxSize (outputBufferPtrArr[outputBufferIndex]);
+                    }
+                }
+            }
+
+            if ((error == ARNETWORK_OK) && (numberOfCell > 0))
+            {
+                shardPtr->frameQueue = ARNETWORK_LockFreeQueue_New (numberOfCell, sizeof (ARNETWORKAL_Frame_t) + shardPtr->maxDataSize);
+                if (shardPtr->frameQueue == NULL)
+                {
+                    error = ARNETWORK_ERROR_ALLOC;
+                }
+            }
         }
 
         /** delete the receiver if an error occurred */
@@ -154,6 +270,7 @@ void ARNETWORK_Receiver_Delete (ARNETWORK_Receiver_t **receiverPtrAddr)
 
     /** local declarations */
     ARNETWORK_Receiver_t *receiverPtr = NULL;
+    int shardIndex = 0;
 
     if (receiverPtrAddr)
     {
@@ -165,6 +282,19 @@ void ARNETWORK_Receiver_Delete (ARNETWORK_Receiver_t **receiverPtrAddr)
             close(receiverPtr->inputEventFd);
             receiverPtr->inputEventFd = -1;
 #endif
+            if (receiverPtr->shardArr != NULL)
+            {
+                for (shardIndex = 0; shardIndex < receiverPtr->numberOfShards; ++shardIndex)
+                {
+                    ARNETWORK_LockFreeQueue_Delete (&(receiverPtr->shardArr[shardIndex].frameQueue));
+                    ARSAL_Cond_Destroy (&(receiverPtr->shardArr[shardIndex].newFramesCond));
+                    ARSAL_Mutex_Destroy (&(receiverPtr->shardArr[shardIndex].newFramesMutex));
+                }
+                free (receiverPtr->shardArr);
+                receiverPtr->shardArr = NULL;
+            }
+            ARSAL_Cond_Destroy (&(receiverPtr->readableCond));
+            ARSAL_Mutex_Destroy (&(receiverPtr->readableMutex));
             free (receiverPtr);
             receiverPtr = NULL;
         }
@@ -179,11 +309,13 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
     /** local declarations */
     ARNETWORK_Receiver_t *receiverPtr = data;
     ARNETWORKAL_Frame_t frame ;
-    ARNETWORK_IOBuffer_t* outBufferPtrTemp = NULL;
     eARNETWORK_ERROR error = ARNETWORK_OK;
     eARNETWORKAL_MANAGER_RETURN result = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
     uint8_t ackSeqNumData = 0;
+    int numberOfFreeCells = -1;
     struct timespec now;
+    ARNETWORK_ReceiverShard_t *shardPtr = NULL;
+    int shardIndex = 0;
 
     while (receiverPtr->isAlive)
     {
@@ -191,6 +323,7 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
         if (receiverPtr->networkALManager->receive(receiverPtr->networkALManager) == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
         {
             /** for each frame present in the receiver buffer */
+            receiverPtr->shardArr[0].numberOfDataReceived = 0;
             result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
             while (result == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
             {
@@ -227,9 +360,15 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
 
                     /** get the acknowledge sequence number from the data */
                     memcpy (&ackSeqNumData, frame.dataPtr, sizeof(uint8_t));
-                    ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_RECEIVER_TAG, "[%p] - TYPE: ARNETWORKAL_FRAME_TYPE_ACK | SEQ:%d | ID:%d | SEQ ACK : %d", receiverPtr, frame.seq, frame.id, ackSeqNumData);
+                    /** the number of free cells of a flow-controlled output buffer follows the sequence number */
+                    numberOfFreeCells = -1;
+                    if ((frame.size - offsetof (ARNETWORKAL_Frame_t, dataPtr)) >= (2 * sizeof(uint8_t)))
+                    {
+                        numberOfFreeCells = frame.dataPtr[1];
+                    }
+                    ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_RECEIVER_TAG, "[%p] - TYPE: ARNETWORKAL_FRAME_TYPE_ACK | SEQ:%d | ID:%d | SEQ ACK : %d | FREE CELLS : %d", receiverPtr, frame.seq, frame.id, ackSeqNumData, numberOfFreeCells);
                     /** transmit the acknowledgement to the sender */
-                    error = ARNETWORK_Sender_AckReceived (receiverPtr->senderPtr, ARNETWORK_Manager_IDAckToIDInput (receiverPtr->networkALManager, frame.id), ackSeqNumData);
+                    error = ARNETWORK_Sender_AckReceived (receiverPtr->senderPtr, ARNETWORK_Manager_IDAckToIDInput (receiverPtr->networkALManager, frame.id), ackSeqNumData, numberOfFreeCells);
                     if (error != ARNETWORK_OK)
                     {
                         switch (error)
@@ -249,74 +388,14 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                     ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_RECEIVER_TAG, "[%p] - TYPE: ARNETWORKAL_FRAME_TYPE_DATA | SEQ:%d | ID:%d", receiverPtr, frame.seq, frame.id);
 
                     /** push the data received in the output buffer targeted */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
-
-                    if (outBufferPtrTemp != NULL)
-                    {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
-                        {
-                            int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
-                            if (accept > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else if (accept == 0)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] Received a retry for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "[%p] Received an old frame for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
-
-                            if(error != ARNETWORK_OK)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
-                            }
-                        }
-                    }
+                    ARNETWORK_Receiver_DispatchDataFrame (receiverPtr, &frame);
                     break;
 
                 case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
                     ARSAL_PRINT (ARSAL_PRINT_VERBOSE, ARNETWORK_RECEIVER_TAG, "[%p] - TYPE: ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY | SEQ:%d | ID:%d", receiverPtr, frame.seq, frame.id);
 
                     /** push the data received in the output buffer targeted */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
-
-                    if (outBufferPtrTemp != NULL)
-                    {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
-                        {
-                            int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
-                            if (accept > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else if (accept == 0)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] Received a retry for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "[%p] Received an old frame for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
-
-                            if(error != ARNETWORK_OK)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
-                            }
-                        }
-                    }
+                    ARNETWORK_Receiver_DispatchDataFrame (receiverPtr, &frame);
                     break;
 
                 case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
@@ -325,53 +404,7 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                      * push the data received in the output buffer targeted,
                      * save the sequence of the command and return an acknowledgement
                      */
-                    outBufferPtrTemp = receiverPtr->outputBufferPtrMap[frame.id];
-
-                    if (outBufferPtrTemp != NULL)
-                    {
-                        /** lock the IOBuffer */
-                        error = ARNETWORK_IOBuffer_Lock(outBufferPtrTemp);
-                        if(error == ARNETWORK_OK)
-                        {
-                            /** OutBuffer->seqWaitAck used to save the last seq */
-                            int accept = ARNETWORK_IOBuffer_ShouldAcceptData (outBufferPtrTemp, frame.seq);
-                            if (accept > 0)
-                            {
-                                error = ARNETWORK_Receiver_CopyDataRecv(receiverPtr, outBufferPtrTemp, &frame);
-                            }
-                            else if (accept == 0)
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] Received a retry for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "[%p] Received an old frame for buffer %d", receiverPtr, outBufferPtrTemp->ID);
-                            }
-
-                            /** unlock the IOBuffer */
-                            ARNETWORK_IOBuffer_Unlock(outBufferPtrTemp);
-
-                            // data are copied to the IOBuffer, send ACK
-                            if (error == ARNETWORK_OK)
-                            {
-                                 /** sending ack even if the seq is not correct */
-                                 error = ARNETWORK_Receiver_ReturnACK(receiverPtr, frame.id, frame.seq);
-                                 if(error != ARNETWORK_OK)
-                                 {
-                                     int level = ARSAL_PRINT_ERROR;
-                                     if (error == ARNETWORK_ERROR_BUFFER_SIZE)
-                                     {
-                                         level = ARSAL_PRINT_DEBUG;
-                                     }
-                                     ARSAL_PRINT(level, ARNETWORK_RECEIVER_TAG, "[%p] ReturnACK, error: %s", receiverPtr, ARNETWORK_Error_ToString(error));
-                                 }
-                            }
-                            else
-                            {
-                                ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data with ack received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
-                            }
-                        }
-                    }
+                    ARNETWORK_Receiver_DispatchDataFrame (receiverPtr, &frame);
                     break;
 
                 default:
@@ -382,7 +415,80 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
                 /** get the next frame*/
                 result = receiverPtr->networkALManager->popFrame(receiverPtr->networkALManager, &frame);
             }
+
+            ARNETWORK_Receiver_NotifyDataReceived (&(receiverPtr->shardArr[0]));
+
+            /** wake up the shards which got frames */
+            for (shardIndex = 1; shardIndex < receiverPtr->numberOfShards; ++shardIndex)
+            {
+                shardPtr = &(receiverPtr->shardArr[shardIndex]);
+                if (shardPtr->hasPushedFrames)
+                {
+                    shardPtr->hasPushedFrames = 0;
+                    ARSAL_Mutex_Lock (&(shardPtr->newFramesMutex));
+                    shardPtr->hasNewFrames = 1;
+                    ARSAL_Cond_Signal (&(shardPtr->newFramesCond));
+                    ARSAL_Mutex_Unlock (&(shardPtr->newFramesMutex));
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+ARNETWORK_ReceiverShard_t* ARNETWORK_Receiver_GetShard (ARNETWORK_Receiver_t *receiverPtr, int shardIndex)
+{
+    /** -- Gets a receiver shard -- */
+
+    /** local declarations */
+    ARNETWORK_ReceiverShard_t *shardPtr = NULL;
+
+    if ((shardIndex >= 0) && (shardIndex < receiverPtr->numberOfShards))
+    {
+        shardPtr = &(receiverPtr->shardArr[shardIndex]);
+    }
+
+    return shardPtr;
+}
+
+void* ARNETWORK_Receiver_ShardThreadRun (void *data)
+{
+    /** -- Manage the data received by the output buffers assigned to a receiver shard -- */
+
+    /** local declarations */
+    ARNETWORK_ReceiverShard_t *shardPtr = data;
+    ARNETWORK_Receiver_t *receiverPtr = shardPtr->receiverPtr;
+    ARNETWORKAL_Frame_t frame;
+    uint8_t *cellPtr = NULL;
+
+    while (receiverPtr->isAlive)
+    {
+        /** wait frames */
+        ARSAL_Mutex_Lock (&(shardPtr->newFramesMutex));
+        if ((!shardPtr->hasNewFrames) && (receiverPtr->isAlive))
+        {
+            ARSAL_Cond_Timedwait (&(shardPtr->newFramesCond), &(shardPtr->newFramesMutex), ARNETWORK_RECEIVER_SHARD_WAIT_TIME_MS);
         }
+        shardPtr->hasNewFrames = 0;
+        ARSAL_Mutex_Unlock (&(shardPtr->newFramesMutex));
+
+        /** for each frame present in the queue of the shard */
+        shardPtr->numberOfDataReceived = 0;
+        cellPtr = (shardPtr->frameQueue != NULL) ? ARNETWORK_LockFreeQueue_Front (shardPtr->frameQueue) : NULL;
+        while (cellPtr != NULL)
+        {
+            /** the data of the frame follows it in the cell */
+            memcpy (&frame, cellPtr, sizeof (ARNETWORKAL_Frame_t));
+            frame.dataPtr = cellPtr + sizeof (ARNETWORKAL_Frame_t);
+
+            ARNETWORK_Receiver_ProcessDataFrame (shardPtr, receiverPtr->outputBufferPtrMap[frame.id], &frame);
+
+            ARNETWORK_LockFreeQueue_PopFront (shardPtr->frameQueue);
+            cellPtr = ARNETWORK_LockFreeQueue_Front (shardPtr->frameQueue);
+        }
+
+        ARNETWORK_Receiver_NotifyDataReceived (shardPtr);
     }
 
     return NULL;
@@ -391,23 +497,77 @@ void* ARNETWORK_Receiver_ThreadRun (void *data)
 void ARNETWORK_Receiver_Stop (ARNETWORK_Receiver_t *receiverPtr)
 {
     /** -- stop the reception -- */
+
+    /** local declarations */
+    int shardIndex = 0;
+
     receiverPtr->isAlive = 0;
+
+    /** wake up the shards */
+    for (shardIndex = 1; shardIndex < receiverPtr->numberOfShards; ++shardIndex)
+    {
+        ARSAL_Mutex_Lock (&(receiverPtr->shardArr[shardIndex].newFramesMutex));
+        ARSAL_Cond_Signal (&(receiverPtr->shardArr[shardIndex].newFramesCond));
+        ARSAL_Mutex_Unlock (&(receiverPtr->shardArr[shardIndex].newFramesMutex));
+    }
 }
 
-eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK (ARNETWORK_Receiver_t *receiverPtr, int id, uint8_t seq)
+eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK (ARNETWORK_Receiver_t *receiverPtr, int id, uint8_t seq, int numberOfFreeCells)
 {
     /** -- return an acknowledgement -- */
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_IOBuffer_t* ACKIOBufferPtr = receiverPtr->outputBufferPtrMap[ARNETWORK_Manager_IDOutputToIDAck (receiverPtr->networkALManager, id)];
+    uint8_t ackData[2] = {seq, 0};
+    int ackDataSize = sizeof(seq);
+    int isEmpty = 0;
 
     if (ACKIOBufferPtr != NULL)
     {
-        int isEmpty = ARNETWORK_RingBuffer_IsEmpty(ACKIOBufferPtr->dataDescriptorRBuffer);
-        error = ARNETWORK_IOBuffer_AddData (ACKIOBufferPtr, (uint8_t*) &seq, sizeof(seq), NULL, NULL, 1);
+        /** the number of free cells is added after the sequence number ; an old device reads only the sequence number */
+        if (numberOfFreeCells >= 0)
+        {
+            ackData[1] = (numberOfFreeCells > UINT8_MAX) ? UINT8_MAX : (uint8_t) numberOfFreeCells;
+            ackDataSize++;
+        }
+
+        /** the acknowledgements are returned by the receiver shards and by the readers of the flow-controlled output buffers */
+        error = ARNETWORK_IOBuffer_Lock (ACKIOBufferPtr);
+        if (error == ARNETWORK_OK)
+        {
+            isEmpty = ARNETWORK_RingBuffer_IsEmpty(ACKIOBufferPtr->dataDescriptorRBuffer);
+            error = ARNETWORK_IOBuffer_AddData (ACKIOBufferPtr, ackData, ackDataSize, NULL, NULL, 1);
+            ARNETWORK_IOBuffer_Unlock (ACKIOBufferPtr);
+        }
+
         if (error == ARNETWORK_OK && isEmpty > 0)
         {
-            ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr);
+            ARNETWORK_Sender_SignalNewData (receiverPtr->senderPtr, ACKIOBufferPtr);
+        }
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_UpdateFlowControl (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr)
+{
+    /** -- advertise the free cells of a flow-controlled output buffer which advertised it was full -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int numberOfFreeCells = 0;
+
+    if ((outputBufferPtr->isFlowControlled) && (outputBufferPtr->hasAdvertisedNoFreeCell))
+    {
+        numberOfFreeCells = ARNETWORK_RingBuffer_GetFreeCellNumber (outputBufferPtr->dataDescriptorRBuffer);
+        if (numberOfFreeCells > 0)
+        {
+            /** acknowledgement of the last data stored: it only resumes the sending of the remote input buffer */
+            error = ARNETWORK_Receiver_ReturnACK (receiverPtr, outputBufferPtr->ID, outputBufferPtr->seq, numberOfFreeCells);
+            if (error == ARNETWORK_OK)
+            {
+                outputBufferPtr->hasAdvertisedNoFreeCell = 0;
+            }
         }
     }
 
@@ -477,7 +637,7 @@ eARNETWORK_ERROR ARNETWORK_Receiver_ReadEventFd(ARNETWORK_Receiver_t *receiverPt
  *
  *****************************************/
 
-eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr)
+eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_ReceiverShard_t *shardPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr)
 {
     /** -- copy the data received to the output buffer -- */
 
@@ -485,14 +645,34 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
     eARNETWORK_ERROR error = ARNETWORK_OK;
     int semError = 0;
     int dataSize = 0;
+    int wasEmpty = ARNETWORK_RingBuffer_IsEmpty (outputBufferPtr->dataDescriptorRBuffer);
+    int isHandled = 0;
+    int isBroadcast = 0;
 
     int nbNew = ARNETWORK_IOBuffer_ShouldAcceptData (outputBufferPtr, framePtr->seq);
 
     /** get the data size*/
     dataSize = framePtr->size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
 
-    /** if the output buffer can copy the data */
-    if (ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
+    if (outputBufferPtr->outputHandler != NULL)
+    {
+        /** give the data to the handler of the output buffer, without copy */
+        outputBufferPtr->outputHandler (outputBufferPtr->ID, framePtr->dataPtr, dataSize, outputBufferPtr->outputHandlerCustomData);
+        isHandled = 1;
+    }
+    else if (outputBufferPtr->isLatestOnly)
+    {
+        /** replace the previous data in the slot of the output buffer, read without lock */
+        error = ARNETWORK_IOBuffer_WriteLatestData (outputBufferPtr, framePtr->dataPtr, dataSize);
+        isHandled = 1;
+    }
+    else if (outputBufferPtr->broadcastRing != NULL)
+    {
+        /** add the data for all the subscribers, overwriting the data not read by the slowest ones */
+        error = ARNETWORK_BroadcastRing_PushBack (outputBufferPtr->broadcastRing, framePtr->dataPtr, dataSize);
+        isBroadcast = 1;
+    }
+    else if (ARNETWORK_IOBuffer_CanCopyData (outputBufferPtr))
     {
         /** copy the data in the IOBuffer */
         error = ARNETWORK_IOBuffer_AddData (outputBufferPtr, framePtr->dataPtr, dataSize, NULL, NULL, 1);
@@ -500,7 +680,7 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
     else
     {
         error = ARNETWORK_ERROR_BAD_PARAMETER;
-        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] Error: output buffer can't copy data", receiverPtr);
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] Error: output buffer can't copy data", shardPtr->receiverPtr);
     }
 
     if (error == ARNETWORK_OK)
@@ -509,6 +689,16 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
         outputBufferPtr->nbPackets++;
         outputBufferPtr->nbNetwork += nbNew;
         outputBufferPtr->seq = framePtr->seq;
+    }
+
+    /** a data given to the handler, or kept in the slot of the latest data, is not queued: no reader to wake up */
+    if ((error == ARNETWORK_OK) && (isBroadcast))
+    {
+        /** the subscribers do not take the semaphore: they are only woken up at the end of the batch of frames */
+        shardPtr->numberOfDataReceived++;
+    }
+    else if ((error == ARNETWORK_OK) && (!isHandled))
+    {
         /** post a semaphore to indicate data ready to be read */
         semError = ARSAL_Sem_Post (&(outputBufferPtr->outputSem));
 
@@ -517,11 +707,268 @@ eARNETWORK_ERROR ARNETWORK_Receiver_CopyDataRecv (ARNETWORK_Receiver_t *receiver
             error = ARNETWORK_ERROR_SEMAPHORE;
         }
 
+        /** the consumers are notified at the end of the batch of frames ; the readable eventfd of the output buffer only when it becomes not empty */
+        shardPtr->numberOfDataReceived++;
+        if (wasEmpty)
+        {
+            ARNETWORK_IOBuffer_UpdateReadableEventFd (outputBufferPtr);
+        }
+    }
+
+    return error;
+}
+
+void ARNETWORK_Receiver_ProcessDataFrame (ARNETWORK_ReceiverShard_t *shardPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, ARNETWORKAL_Frame_t *framePtr)
+{
+    /** -- give a data frame to its output buffer -- */
+
+    /** local declarations */
+    ARNETWORK_Receiver_t *receiverPtr = shardPtr->receiverPtr;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int accept = 0;
+    int numberOfFreeCells = -1;
+    uint8_t lastSeq = 0;
+
+    /** lock the IOBuffer */
+    error = ARNETWORK_IOBuffer_Lock(outputBufferPtr);
+    if(error == ARNETWORK_OK)
+    {
+        /** OutBuffer->seqWaitAck used to save the last seq */
+        accept = ARNETWORK_IOBuffer_ShouldAcceptData (outputBufferPtr, framePtr->seq);
+        if (accept > 0)
+        {
+            error = ARNETWORK_Receiver_CopyDataRecv(shardPtr, outputBufferPtr, framePtr);
+        }
+        else if (accept == 0)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] Received a retry for buffer %d", receiverPtr, outputBufferPtr->ID);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_WARNING, ARNETWORK_RECEIVER_TAG, "[%p] Received an old frame for buffer %d", receiverPtr, outputBufferPtr->ID);
+        }
+
+        /** a flow-controlled output buffer advertises its free cells, and must advertise the next free cell once it is full */
+        if ((outputBufferPtr->isFlowControlled) && ((error == ARNETWORK_OK) || (error == ARNETWORK_ERROR_BUFFER_SIZE) || (error == ARNETWORK_ERROR_BUFFER_FULL)))
+        {
+            numberOfFreeCells = ARNETWORK_RingBuffer_GetFreeCellNumber (outputBufferPtr->dataDescriptorRBuffer);
+            if (numberOfFreeCells == 0)
+            {
+                outputBufferPtr->hasAdvertisedNoFreeCell = 1;
+            }
+            lastSeq = outputBufferPtr->seq;
+        }
+
+        /** unlock the IOBuffer */
+        ARNETWORK_IOBuffer_Unlock(outputBufferPtr);
+
+        if(error != ARNETWORK_OK)
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received, error: %s", receiverPtr, ARNETWORK_Error_ToString (error));
+
+            /** the data is not acknowledged: the acknowledgement of the last data stored pauses the remote input buffer instead of letting it retry */
+            if (((error == ARNETWORK_ERROR_BUFFER_SIZE) || (error == ARNETWORK_ERROR_BUFFER_FULL)) && (numberOfFreeCells == 0))
+            {
+                error = ARNETWORK_Receiver_ReturnACK(receiverPtr, framePtr->id, lastSeq, numberOfFreeCells);
+                if(error != ARNETWORK_OK)
+                {
+                    ARSAL_PRINT(ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] ReturnACK, error: %s", receiverPtr, ARNETWORK_Error_ToString(error));
+                }
+            }
+        }
+        else if (framePtr->type == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+        {
+            // data are copied to the IOBuffer, send ACK
+            /** sending ack even if the seq is not correct */
+            error = ARNETWORK_Receiver_ReturnACK(receiverPtr, framePtr->id, framePtr->seq, numberOfFreeCells);
+            if(error != ARNETWORK_OK)
+            {
+                int level = ARSAL_PRINT_ERROR;
+                if (error == ARNETWORK_ERROR_BUFFER_SIZE)
+                {
+                    level = ARSAL_PRINT_DEBUG;
+                }
+                ARSAL_PRINT(level, ARNETWORK_RECEIVER_TAG, "[%p] ReturnACK, error: %s", receiverPtr, ARNETWORK_Error_ToString(error));
+            }
+        }
+    }
+}
+
+void ARNETWORK_Receiver_DispatchDataFrame (ARNETWORK_Receiver_t *receiverPtr, ARNETWORKAL_Frame_t *framePtr)
+{
+    /** -- process a data frame, or copy it in the queue of its receiver shard -- */
+
+    /** local declarations */
+    ARNETWORK_IOBuffer_t *outputBufferPtr = receiverPtr->outputBufferPtrMap[framePtr->id];
+    ARNETWORK_ReceiverShard_t *shardPtr = NULL;
+    uint8_t *cellPtr = NULL;
+    uint32_t position = 0;
+    int dataSize = 0;
+
+    if ((outputBufferPtr != NULL) && (outputBufferPtr->receiverShard == 0))
+    {
+        /** the receiving thread processes the shard 0 */
+        ARNETWORK_Receiver_ProcessDataFrame (&(receiverPtr->shardArr[0]), outputBufferPtr, framePtr);
+    }
+    else if (outputBufferPtr != NULL)
+    {
+        /** the frame and its data are copied: the reception buffer of ARNetworkAL is reused by the next receipt */
+        shardPtr = &(receiverPtr->shardArr[outputBufferPtr->receiverShard]);
+        dataSize = framePtr->size - offsetof (ARNETWORKAL_Frame_t, dataPtr);
+
+        if ((dataSize >= 0) && (dataSize <= shardPtr->maxDataSize))
+        {
+            cellPtr = ARNETWORK_LockFreeQueue_ReserveBack (shardPtr->frameQueue, &position);
+        }
+        else
+        {
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_RECEIVER_TAG, "[%p] data received for buffer %d, error: %s", receiverPtr, outputBufferPtr->ID, ARNETWORK_Error_ToString (ARNETWORK_ERROR_BUFFER_SIZE));
+        }
+
+        if (cellPtr != NULL)
+        {
+            memcpy (cellPtr, framePtr, sizeof (ARNETWORKAL_Frame_t));
+            memcpy (cellPtr + sizeof (ARNETWORKAL_Frame_t), framePtr->dataPtr, dataSize);
+            ARNETWORK_LockFreeQueue_CommitBack (shardPtr->frameQueue, position);
+            shardPtr->hasPushedFrames = 1;
+        }
+        else
+        {
+            /** a data with acknowledgement is not acknowledged, so it will be sent again */
+            ARSAL_PRINT (ARSAL_PRINT_DEBUG, ARNETWORK_RECEIVER_TAG, "[%p] data of buffer %d not queued in the receiver shard %d", receiverPtr, outputBufferPtr->ID, shardPtr->index);
+        }
+    }
+}
+
+void ARNETWORK_Receiver_NotifyDataReceived (ARNETWORK_ReceiverShard_t *shardPtr)
+{
+    /** -- notify the consumers of the data added by a batch of frames -- */
+
+    /** local declarations */
+    ARNETWORK_Receiver_t *receiverPtr = shardPtr->receiverPtr;
+
+    if (shardPtr->numberOfDataReceived == 0)
+    {
+        return;
+    }
+
 #ifdef ENABLE_MONITOR_INCOMING_DATA
-        /* write 1 in eventfd to wake up consumer */
-        error = ARNETWORK_Receiver_WriteEventFd(receiverPtr, 1);
+    /* write the number of data in eventfd to wake up consumer */
+    ARNETWORK_Receiver_WriteEventFd (receiverPtr, shardPtr->numberOfDataReceived);
 #endif
+
+    /** the semaphores of the data are posted before the number of waiters is read: a waiter counted after sees the data */
+    if (__atomic_load_n (&(receiverPtr->readableWaitersCount), __ATOMIC_SEQ_CST) > 0)
+    {
+        ARSAL_Mutex_Lock (&(receiverPtr->readableMutex));
+        ARSAL_Cond_Broadcast (&(receiverPtr->readableCond));
+        ARSAL_Mutex_Unlock (&(receiverPtr->readableMutex));
     }
 
-    return error;
+    shardPtr->numberOfDataReceived = 0;
+}
+
+uint32_t ARNETWORK_Receiver_GetReadyMask (ARNETWORK_IOBuffer_t **outputBufferPtrArr, int numberOfOutputBuffers)
+{
+    /** -- get the mask of the output buffers with a data to read -- */
+
+    /** local declarations */
+    uint32_t readyMask = 0;
+    int bufferIndex = 0;
+    int semValue = 0;
+
+    for (bufferIndex = 0; bufferIndex < numberOfOutputBuffers; ++bufferIndex)
+    {
+        /** the value of the semaphore is the number of data not taken by a read function */
+        if ((ARSAL_Sem_Getvalue (&(outputBufferPtrArr[bufferIndex]->outputSem), &semValue) == 0) && (semValue > 0))
+        {
+            readyMask |= (uint32_t) 1 << bufferIndex;
+        }
+    }
+
+    return readyMask;
+}
+
+int ARNETWORK_Receiver_SubscriberHasData (ARNETWORK_IOBuffer_t *outputBufferPtr, int subscriberID)
+{
+    /** -- check if a subscriber of the output buffer has a data to read -- */
+
+    /** local declarations */
+    int hasData = 0;
+
+    ARNETWORK_IOBuffer_Lock (outputBufferPtr);
+    hasData = ARNETWORK_BroadcastRing_HasData (outputBufferPtr->broadcastRing, subscriberID);
+    ARNETWORK_IOBuffer_Unlock (outputBufferPtr);
+
+    return hasData;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_WaitReadable (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t **outputBufferPtrArr, int numberOfOutputBuffers, int timeoutMs, uint32_t *readyMaskPtr)
+{
+    /** -- wait until at least one of the output buffers has a data to read -- */
+
+    /** local declarations */
+    uint32_t readyMask = 0;
+    struct timespec startTime;
+    struct timespec now;
+    int remainingTimeMs = timeoutMs;
+
+    ARSAL_Time_GetTime (&startTime);
+
+    ARSAL_Mutex_Lock (&(receiverPtr->readableMutex));
+
+    /** the waiter is counted before checking the output buffers, so that the receiver does not miss it */
+    __atomic_add_fetch (&(receiverPtr->readableWaitersCount), 1, __ATOMIC_SEQ_CST);
+    readyMask = ARNETWORK_Receiver_GetReadyMask (outputBufferPtrArr, numberOfOutputBuffers);
+
+    while ((readyMask == 0) && (remainingTimeMs > 0))
+    {
+        ARSAL_Cond_Timedwait (&(receiverPtr->readableCond), &(receiverPtr->readableMutex), remainingTimeMs);
+        readyMask = ARNETWORK_Receiver_GetReadyMask (outputBufferPtrArr, numberOfOutputBuffers);
+
+        ARSAL_Time_GetTime (&now);
+        remainingTimeMs = timeoutMs - ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &now);
+    }
+
+    __atomic_sub_fetch (&(receiverPtr->readableWaitersCount), 1, __ATOMIC_SEQ_CST);
+
+    ARSAL_Mutex_Unlock (&(receiverPtr->readableMutex));
+
+    *readyMaskPtr = readyMask;
+
+    return (readyMask != 0) ? ARNETWORK_OK : ARNETWORK_ERROR_BUFFER_EMPTY;
+}
+
+eARNETWORK_ERROR ARNETWORK_Receiver_WaitSubscribedData (ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, int subscriberID, int timeoutMs)
+{
+    /** -- wait until a subscriber of the output buffer has a data to read -- */
+
+    /** local declarations */
+    int hasData = 0;
+    struct timespec startTime;
+    struct timespec now;
+    int remainingTimeMs = timeoutMs;
+
+    ARSAL_Time_GetTime (&startTime);
+
+    ARSAL_Mutex_Lock (&(receiverPtr->readableMutex));
+
+    /** the waiter is counted before checking the output buffer, so that the receiver does not miss it */
+    __atomic_add_fetch (&(receiverPtr->readableWaitersCount), 1, __ATOMIC_SEQ_CST);
+    hasData = ARNETWORK_Receiver_SubscriberHasData (outputBufferPtr, subscriberID);
+
+    while ((!hasData) && (remainingTimeMs > 0))
+    {
+        ARSAL_Cond_Timedwait (&(receiverPtr->readableCond), &(receiverPtr->readableMutex), remainingTimeMs);
+        hasData = ARNETWORK_Receiver_SubscriberHasData (outputBufferPtr, subscriberID);
+
+        ARSAL_Time_GetTime (&now);
+        remainingTimeMs = timeoutMs - ARSAL_Time_ComputeTimespecMsTimeDiff (&startTime, &now);
+    }
+
+    __atomic_sub_fetch (&(receiverPtr->readableWaitersCount), 1, __ATOMIC_SEQ_CST);
+
+    ARSAL_Mutex_Unlock (&(receiverPtr->readableMutex));
+
+    return (hasData) ? ARNETWORK_OK : ARNETWORK_ERROR_BUFFER_EMPTY;
 }
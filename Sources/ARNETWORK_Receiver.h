@@ -41,13 +41,43 @@
 #include <libARNetworkAL/ARNETWORKAL_Manager.h>
 #include "ARNETWORK_IOBuffer.h"
 #include "ARNETWORK_Sender.h"
+#include "ARNETWORK_LockFreeQueue.h"
+
+/**
+ * Time in millisecond waited by a receiver shard without frame to process before to check if it is still alive
+ */
+#define ARNETWORK_RECEIVER_SHARD_WAIT_TIME_MS (500)
+
+typedef struct ARNETWORK_Receiver_t ARNETWORK_Receiver_t;
+
+/**
+ * @brief receiver shard, processing the data received by the output buffers assigned to it
+ * @details The receiving thread copies the frames of the output buffers of a shard above 0 in the queue of the shard, which is processed by the thread of the shard.
+ * The frames of an output buffer are all processed by the same shard, in their order of reception.
+ * @note The shard 0 is processed by the receiving thread itself, with the acknowledgements, the pings and the pongs.
+ */
+typedef struct
+{
+    ARNETWORK_Receiver_t *receiverPtr; /**< Pointer on the Receiver owning the shard */
+    int index; /**< Index of the shard in the Receiver */
+
+    ARNETWORK_LockFreeQueue_t *frameQueue; /**< Frames received for the output buffers of the shard, with their data (NULL for the shard 0) */
+    int maxDataSize; /**< Maximum size of the data of a frame of frameQueue */
+    int hasPushedFrames; /**< Indicator of frames added in frameQueue by the current batch of frames (1 = true | 0 = false) ; only used by the receiving thread */
+
+    ARSAL_Mutex_t newFramesMutex; /**< Mutex of hasNewFrames and newFramesCond */
+    ARSAL_Cond_t newFramesCond; /**< Condition signaled when frames are added in frameQueue */
+    int hasNewFrames; /**< Indicator of frames added in frameQueue since the thread of the shard last checked it (1 = true | 0 = false) */
+
+    int numberOfDataReceived; /**< Number of data added in the output buffers by the batch of frames being processed ; only used by the thread processing the shard */
+}ARNETWORK_ReceiverShard_t;
 
 /**
  * @brief receiver manager
  * @warning before to be used, the receiver must be created through ARNETWORK_Receiver_New().
  * @post after its using, the receiver must be deleted through ARNETWORK_Receiver_Delete().
  */
-typedef struct
+struct ARNETWORK_Receiver_t
 {
 	ARNETWORKAL_Manager_t *networkALManager;
     ARNETWORK_Sender_t *senderPtr; /**< Pointer on the sender which waits the acknowledgments*/
@@ -59,12 +89,18 @@ typedef struct
 
     uint8_t* readingPointer; /** head of reading on the RecvBuffer */
 
-    int isAlive; /**< Indicator of aliving used for kill the thread calling the ARNETWORK_Receiver_ThreadRun function (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Receiver_Stop()*/
+    ARNETWORK_ReceiverShard_t *shardArr; /**< array of the receiver shards */
+    int numberOfShards; /**< number of receiver shards (1 + highest receiverShard of the output buffers) */
+
+    int isAlive; /**< Indicator of aliving used for kill the threads calling the ARNETWORK_Receiver_ThreadRun and ARNETWORK_Receiver_ShardThreadRun functions (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Receiver_Stop()*/
+    ARSAL_Mutex_t readableMutex; /**< Mutex of readableCond */
+    ARSAL_Cond_t readableCond; /**< Condition broadcast, with readableMutex, after a batch of frames adding data in the output buffers, when a thread waits in ARNETWORK_Receiver_WaitReadable() */
+    int readableWaitersCount; /**< Number of threads waiting readableCond ; accessed atomically */
 #ifdef ENABLE_MONITOR_INCOMING_DATA
     int inputEventFd;	/**< event fd readable when inputBuffer is not empty */
 #endif
 
-}ARNETWORK_Receiver_t;
+};
 
 /**
  * @brief Create a new receiver
@@ -99,9 +135,28 @@ void ARNETWORK_Receiver_Delete(ARNETWORK_Receiver_t **receiverPtrAddr);
  */
 void* ARNETWORK_Receiver_ThreadRun(void *data);
 
+/**
+ * @brief Gets a receiver shard
+ * @param receiverPtr pointer on the Receiver
+ * @param[in] shardIndex index of the shard
+ * @return pointer on the shard, or NULL if no output buffer uses this shard
+ * @see ARNETWORK_Receiver_ShardThreadRun()
+ */
+ARNETWORK_ReceiverShard_t* ARNETWORK_Receiver_GetShard(ARNETWORK_Receiver_t *receiverPtr, int shardIndex);
+
+/**
+ * @brief Manage the data received by the output buffers assigned to a receiver shard
+ * @warning This function must be called by a specific thread.
+ * @post Before join the thread calling this function, ARNETWORK_Receiver_Stop() must be called.
+ * @param data thread datas of type ARNETWORK_ReceiverShard_t*
+ * @return NULL
+ * @see ARNETWORK_Receiver_Stop()
+ */
+void* ARNETWORK_Receiver_ShardThreadRun(void *data);
+
 /**
  * @brief stop the reception
- * @details Used to kill the thread calling ARNETWORK_Receiver_ThreadRun().
+ * @details Used to kill the threads calling ARNETWORK_Receiver_ThreadRun() and ARNETWORK_Receiver_ShardThreadRun().
  * @param receiverPtr pointer on the Receiver
  * @see ARNETWORK_Receiver_ThreadRun()
  */
@@ -112,10 +167,44 @@ void ARNETWORK_Receiver_Stop(ARNETWORK_Receiver_t *receiverPtr);
  * @param receiverPtr the pointer on the Receiver
  * @param[in] ID identifier of the command to acknowledged
  * @param[in] seq sequence number of the command to acknowledged
+ * @param[in] numberOfFreeCells number of free cells of the flow-controlled output buffer, sent after the sequence number (-1 = not a flow-controlled output buffer)
  * @return eARNETWORK_ERROR
  * @see ARNETWORK_Receiver_New()
  */
-eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK(ARNETWORK_Receiver_t *receiverPtr, int identifer, uint8_t seq);
+eARNETWORK_ERROR ARNETWORK_Receiver_ReturnACK(ARNETWORK_Receiver_t *receiverPtr, int identifer, uint8_t seq, int numberOfFreeCells);
+
+/**
+ * @brief advertise the free cells of a flow-controlled output buffer which advertised it was full
+ * @details called after data are read from the output buffer, so the remote input buffer paused by the flow control sends again.
+ * @param receiverPtr the pointer on the Receiver
+ * @param outputBufferPtr pointer on the output buffer
+ * @return eARNETWORK_ERROR
+ * @pre the output buffer must be locked
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_UpdateFlowControl(ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr);
+
+/**
+ * @brief wait until at least one of the output buffers has a data to read
+ * @details a data is ready to be read when it is received and not taken by a read function yet.
+ * @param receiverPtr the pointer on the Receiver
+ * @param[in] outputBufferPtrArr the output buffers to wait
+ * @param[in] numberOfOutputBuffers number of output buffers in outputBufferPtrArr ; at most 32
+ * @param[in] timeoutMs maximum time in millisecond to wait (0 = do not wait)
+ * @param[out] readyMaskPtr pointer to store the mask of the output buffers with a data to read: bit i for outputBufferPtrArr[i]
+ * @return ARNETWORK_OK if an output buffer has a data to read, ARNETWORK_ERROR_BUFFER_EMPTY at the end of the timeout
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_WaitReadable(ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t **outputBufferPtrArr, int numberOfOutputBuffers, int timeoutMs, uint32_t *readyMaskPtr);
+
+/**
+ * @brief wait until a subscriber of the output buffer has a data to read
+ * @param receiverPtr the pointer on the Receiver
+ * @param outputBufferPtr the output buffer, with a broadcast ring
+ * @param[in] subscriberID identifier of the subscriber
+ * @param[in] timeoutMs maximum time in millisecond to wait (0 = do not wait)
+ * @return ARNETWORK_OK if the subscriber has a data to read, ARNETWORK_ERROR_BUFFER_EMPTY at the end of the timeout
+ * @pre the output buffer must not be locked
+ */
+eARNETWORK_ERROR ARNETWORK_Receiver_WaitSubscribedData(ARNETWORK_Receiver_t *receiverPtr, ARNETWORK_IOBuffer_t *outputBufferPtr, int subscriberID, int timeoutMs);
 
 /**
  * @brief return receiver fd used for monitoring incoming data (linux only)
@@ -172,9 +172,24 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
 {
     /* -- Add the new data at the back of the ring buffer with specification of the data size -- */
 
+    /* local declarations */
+    struct iovec segment;
+
+    segment.iov_base = (void *) newData;
+    segment.iov_len = dataSize;
+
+    return ARNETWORK_RingBuffer_PushBackSegments(ringBuffer, &segment, 1, dataCopy);
+}
+
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackSegments(ARNETWORK_RingBuffer_t *ringBuffer, const struct iovec *segmentArr, int numberOfSegments, uint8_t **dataCopy)
+{
+    /* -- Add the new data made of several segments at the back of the ring buffer -- */
+
     /* local declarations */
     int error = ARNETWORK_OK;
     uint8_t* buffer = NULL;
+    size_t offset = 0;
+    int segmentIndex = 0;
 
     ARSAL_Mutex_Lock(&(ringBuffer->mutex));
 
@@ -189,7 +204,11 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *r
 
         buffer = ringBuffer->dataBuffer + ( ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize) );
 
-        memcpy(buffer, newData, dataSize);
+        for (segmentIndex = 0; segmentIndex < numberOfSegments; ++segmentIndex)
+        {
+            memcpy(buffer + offset, segmentArr[segmentIndex].iov_base, segmentArr[segmentIndex].iov_len);
+            offset += segmentArr[segmentIndex].iov_len;
+        }
 
         /* return the pointer on the data copy in the ring buffer */
         if(dataCopy != NULL)
@@ -250,6 +269,64 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFrontWithSize(ARNETWORK_RingBuffer_t *r
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_RingBuffer_DiscardFront(ARNETWORK_RingBuffer_t *ringBuffer, unsigned int numberOfData)
+{
+    /* -- Pop several of the oldest data at once -- */
+
+    /* local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    if (numberOfData <= (ringBuffer->numberOfCell - ARNETWORK_RingBuffer_GetFreeCellNumberUnlocked(ringBuffer)))
+    {
+        /* the data are not read: only the output index moves */
+        (ringBuffer->indexOutput) += numberOfData * ringBuffer->cellSize;
+        ARNETWORK_RingBuffer_NormalizeIndexes(ringBuffer);
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PopBack(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop)
+{
+    /* -- Pop the newest data -- */
+
+    /* local declarations */
+    uint8_t *buffer = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    if (!ARNETWORK_RingBuffer_IsEmptyUnlocked(ringBuffer))
+    {
+        /* the input index is never normalized below the output index: it can be decremented */
+        (ringBuffer->indexInput) -= ringBuffer->cellSize;
+
+        if(dataPop != NULL)
+        {
+            /* get the address of the back data */
+            buffer = ringBuffer->dataBuffer + (ringBuffer->indexInput % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+            memcpy(dataPop, buffer, ringBuffer->cellSize);
+        }
+        /* No else: the data popped is not returned  */
+    }
+    else
+    {
+        error = ARNETWORK_ERROR_BUFFER_EMPTY;
+    }
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return error;
+}
+
 eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontData)
 {
     /* -- Return a pointer on the front data -- */
@@ -277,6 +354,68 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer,
     return error;
 }
 
+int ARNETWORK_RingBuffer_FrontN(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontDataArr, unsigned int maxNumberOfData)
+{
+    /* -- Copy several of the oldest data at once -- */
+
+    /* local declarations */
+    size_t bufferSize = ringBuffer->cellSize * ringBuffer->numberOfCell;
+    size_t frontOffset = 0;
+    size_t copySize = 0;
+    size_t firstCopySize = 0;
+    unsigned int numberOfData = 0;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    numberOfData = (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize;
+    if (numberOfData > maxNumberOfData)
+    {
+        numberOfData = maxNumberOfData;
+    }
+
+    if (numberOfData > 0)
+    {
+        /* the data wrapping at the end of the buffer are copied in two parts */
+        frontOffset = ringBuffer->indexOutput % bufferSize;
+        copySize = numberOfData * ringBuffer->cellSize;
+        firstCopySize = ((bufferSize - frontOffset) < copySize) ? (bufferSize - frontOffset) : copySize;
+
+        memcpy(frontDataArr, ringBuffer->dataBuffer + frontOffset, firstCopySize);
+        if (copySize > firstCopySize)
+        {
+            memcpy(frontDataArr + firstCopySize, ringBuffer->dataBuffer, copySize - firstCopySize);
+        }
+    }
+    /* No else: the ring buffer is empty */
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return numberOfData;
+}
+
+uint8_t* ARNETWORK_RingBuffer_GetDataPtr(ARNETWORK_RingBuffer_t *ringBuffer, unsigned int index)
+{
+    /* -- Return a pointer on a data stored in the ring buffer -- */
+
+    /* local declarations */
+    uint8_t *buffer = NULL;
+    unsigned int numberOfData = 0;
+
+    ARSAL_Mutex_Lock(&(ringBuffer->mutex));
+
+    numberOfData = (ringBuffer->indexInput - ringBuffer->indexOutput) / ringBuffer->cellSize;
+
+    if (index < numberOfData)
+    {
+        buffer = ringBuffer->dataBuffer + ((ringBuffer->indexOutput + (index * ringBuffer->cellSize)) % (ringBuffer->numberOfCell * ringBuffer->cellSize));
+    }
+    /* No else: no data at this position */
+
+    ARSAL_Mutex_Unlock(&(ringBuffer->mutex));
+
+    return buffer;
+}
+
 void ARNETWORK_RingBuffer_Print(ARNETWORK_RingBuffer_t *ringBuffer)
 {
     /* -- Print the state of the ring buffer -- */
@@ -40,6 +40,7 @@
 
 #include <libARSAL/ARSAL_Mutex.h>
 #include <inttypes.h>
+#include <sys/uio.h>
 
 /**
  * @brief Basic ring buffer, multithread safe
@@ -116,6 +117,18 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBack(ARNETWORK_RingBuffer_t *ringBuffe
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackWithSize(ARNETWORK_RingBuffer_t *ringBuffer, const uint8_t *newData, int dataSize, uint8_t **dataCopy);
 
+/**
+ * @brief Add the new data made of several segments at the back of the ring buffer
+ * @details the segments are copied one after the other in the same cell.
+ * @warning the total size of the segments must not be more than ring buffer's cell size
+ * @param ringBuffer the ring buffer which will push back
+ * @param[in] segmentArr array of the segments of the data to add
+ * @param[in] numberOfSegments number of segments in segmentArr
+ * @param[out] dataCopy address to return the pointer on the data copy in the ring buffer ; can be equal to NULL
+ * @return error eARNETWORK_ERROR
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PushBackSegments(ARNETWORK_RingBuffer_t *ringBuffer, const struct iovec *segmentArr, int numberOfSegments, uint8_t **dataCopy);
+
 /**
  * @brief Pop the oldest data
  * @param ringBuffer the ring buffer which will pop front
@@ -135,6 +148,31 @@ eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFront(ARNETWORK_RingBuffer_t *ringBuffe
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_PopFrontWithSize(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop, int dataSize);
 
+/**
+ * @brief Pop several of the oldest data at once, without reading them
+ * @param ringBuffer the ring buffer which will pop front
+ * @param[in] numberOfData number of data to pop
+ * @return error eARNETWORK_ERROR ; ARNETWORK_ERROR_BUFFER_EMPTY, without popping any data, if the ring buffer has less than numberOfData data
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_DiscardFront(ARNETWORK_RingBuffer_t *ringBuffer, unsigned int numberOfData);
+
+/**
+ * @brief Copy several of the oldest data at once, without popping them
+ * @param ringBuffer the ring buffer which will give its front data
+ * @param[out] frontDataArr array of maxNumberOfData cells in which the front data are copied, the oldest first
+ * @param[in] maxNumberOfData maximum number of data to copy
+ * @return number of data copied
+**/
+int ARNETWORK_RingBuffer_FrontN(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontDataArr, unsigned int maxNumberOfData);
+
+/**
+ * @brief Pop the newest data
+ * @param ringBuffer the ring buffer which will pop back
+ * @param[out] dataPop pointer on the data popped ; can be equal to NULL
+ * @return error eARNETWORK_ERROR
+**/
+eARNETWORK_ERROR ARNETWORK_RingBuffer_PopBack(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *dataPop);
+
 /**
  * @brief Return the number of free cell of the ring buffer
  * @param ringBuffer the ring buffer which will give the number of its free cells
@@ -157,6 +195,15 @@ int ARNETWORK_RingBuffer_IsEmpty(ARNETWORK_RingBuffer_t *ringBuffer);
 **/
 eARNETWORK_ERROR ARNETWORK_RingBuffer_Front(ARNETWORK_RingBuffer_t *ringBuffer, uint8_t *frontData);
 
+/**
+ * @brief Return a pointer on a data stored in the ring buffer
+ * @warning the pointer is valid only while the data is not popped or overwritten
+ * @param ringBuffer the ring buffer which will give the data
+ * @param[in] index position of the data from the front (0 is the oldest data)
+ * @return pointer on the data in the ring buffer, or NULL if there is no data at this position
+**/
+uint8_t* ARNETWORK_RingBuffer_GetDataPtr(ARNETWORK_RingBuffer_t *ringBuffer, unsigned int index);
+
 /**
  * @brief Clean the ring buffer
  * @param ringBuffer the ring buffer to clean
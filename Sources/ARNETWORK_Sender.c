@@ -81,13 +81,67 @@
 /**
  * @brief add data to the sender buffer and callback with sent status
  * @param senderPtr the pointer on the Sender
+ * @param lanePtr the pointer on the sender lane of the input buffer
  * @param inputBufferPtr Pointer on the input buffer
  * @param isRetry Don't increment sequence number for retries
  * @return error eARNETWORK_ERROR
- * @note only call by ARNETWORK_Sender_ThreadRun()
- * @see ARNETWORK_Sender_ThreadRun()
+ * @note only call by ARNETWORK_Sender_LaneThreadRun()
+ * @see ARNETWORK_Sender_LaneThreadRun()
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int isRetry);
+
+/**
+ * @brief add a batch of data to the sender buffer and callback with sent status
+ * @details The frames of the latest data of the input buffer allowed by its token bucket are given to ARNetworkAL in one batch.
+ * Then, in the order of the data, the data given to ARNetworkAL are called back with sent status and popped (or wait their acknowledgement),
+ * and the first data not given is handled as an overflow.
+ * @param senderPtr the pointer on the Sender
+ * @param lanePtr the pointer on the sender lane of the input buffer
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] maxNumberOfData maximum number of data of the batch
+ * @param[out] numberOfDataSentPtr number of data given to ARNetworkAL, or dropped on overflow
+ * @return error eARNETWORK_ERROR
+ * @note only call by ARNETWORK_Sender_LaneThreadRun()
+ * @see ARNETWORK_Sender_LaneThreadRun()
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_AddBatchToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int maxNumberOfData, int *numberOfDataSentPtr);
+
+/**
+ * @brief give frames to ARNetworkAL, in one hold of ARNetworkAL
+ * @details The frames are given in order until ARNetworkAL refuses one.
+ * @param senderPtr the pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer of the frames
+ * @param[in] frameArr array of the frames to give
+ * @param[in] numberOfFrames number of frames in the array
+ * @param[in] isUrgent 1 if the frames must be sent without waiting the end of the send coalescing window ; the low latency frames, the acknowledgements and the frames of the internal buffers are always urgent
+ * @param[out] alStatusPtr status of ARNetworkAL for the first frame not given, or ARNETWORKAL_MANAGER_RETURN_DEFAULT if all the frames are given
+ * @param[out] overflowWaitTimeMsPtr time to wait if ARNetworkAL is full
+ * @return number of frames given to ARNetworkAL
+ */
+int ARNETWORK_Sender_PushFrames (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, ARNETWORKAL_Frame_t *frameArr, int numberOfFrames, int isUrgent, eARNETWORKAL_MANAGER_RETURN *alStatusPtr, int *overflowWaitTimeMsPtr);
+
+/**
+ * @brief handle the overflow of ARNetworkAL on a data of an input buffer
+ * @param senderPtr the pointer on the Sender
+ * @param lanePtr the pointer on the sender lane of the input buffer
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] frame frame of the data refused by ARNetworkAL
+ * @param[in] waitTimeMs time to wait before the next run of the lane
+ * @return ARNETWORK_OK if the data is dropped, ARNETWORK_ERROR_BUFFER_SIZE if the data is kept in the input buffer
+ */
+eARNETWORK_ERROR ARNETWORK_Sender_ManageOverflow (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, const ARNETWORKAL_Frame_t *frame, int waitTimeMs);
+
+/**
+ * @brief add the periodic data of an input buffer to the sender buffer
+ * @details The periodic data is updated by its update callback, then given to ARNetworkAL ; the next sending is scheduled if the data is sent or dropped.
+ * @param senderPtr the pointer on the Sender
+ * @param lanePtr the pointer on the sender lane of the input buffer
+ * @param inputBufferPtr Pointer on the input buffer
+ * @return error eARNETWORK_ERROR
+ * @note only call by ARNETWORK_Sender_LaneThreadRun()
+ * @see ARNETWORK_Sender_LaneThreadRun()
  */
-eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int isRetry);
+eARNETWORK_ERROR ARNETWORK_Sender_AddPeriodicToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr);
 
 /**
  * @brief call the Callback this timeout status
@@ -111,6 +165,88 @@ void ARNETWORK_Sender_ManageTimeOut (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IO
 
 
 
+/**
+ * @brief get the time to wait before the next processing of an input buffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] maxWaitTimeMs maximum time to wait
+ * @return the time to wait in millisecond, less or equal to maxWaitTimeMs
+ * @note only call by ARNETWORK_Sender_ThreadRun()
+ * @see ARNETWORK_Sender_ThreadRun()
+ */
+int ARNETWORK_Sender_GetBufferWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr, int maxWaitTimeMs);
+
+/**
+ * @brief get the time to wait before the token bucket of the input buffer allows to send its next data
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param inputBufferPtr Pointer on the input buffer
+ * @return 0 if the next data can be sent now, otherwise the time to wait in millisecond
+ */
+int ARNETWORK_Sender_GetRateLimitWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief get the time to wait before the token bucket allows to send the periodic data of the input buffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param inputBufferPtr Pointer on the input buffer
+ * @return the time to wait in millisecond ; 0 if the input buffer is not rate limited or has no periodic data
+ */
+int ARNETWORK_Sender_GetPeriodicRateLimitWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief get the time to wait before the sending date of the front data of the input buffer
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @param inputBufferPtr Pointer on the input buffer
+ * @return the time to wait in microsecond ; 0 if the front data has no sending date, if it is reached, or if the input buffer waits an acknowledgement
+ */
+int64_t ARNETWORK_Sender_GetScheduledWaitTimeUs (ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief send the data given to ARNetworkAL and update the estimation of its drain rate
+ * @warning The ARNetworkAL mutex must lock before the calling of this function and unlock after.
+ * @param senderPtr the pointer on the Sender
+ */
+void ARNETWORK_Sender_SendAndMeasureDrainRate (ARNETWORK_Sender_t *senderPtr);
+
+/**
+ * @brief get the time to wait after an overflow of ARNetworkAL
+ * @param senderPtr the pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer which overflowed
+ * @return the time to wait in millisecond
+ */
+int ARNETWORK_Sender_GetOverflowWaitTimeMs (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief get the time remaining before the end of the send coalescing window
+ * @warning The ARNetworkAL mutex must lock before the calling of this function and unlock after.
+ * @param senderPtr the pointer on the Sender
+ * @param[in] now current date
+ * @return the time remaining in microsecond, or a negative value if no frame is held in ARNetworkAL by the coalescing window
+ */
+int64_t ARNETWORK_Sender_GetCoalescingRemainingTimeUs (ARNETWORK_Sender_t *senderPtr, const struct timespec *now);
+
+/**
+ * @brief sleep until a sending date or the end of the send coalescing window less than a millisecond away, or until new data are signalled to the sender lane
+ * @param lanePtr the pointer on the sender lane
+ * @param[in] waitTimeUs time to wait in microsecond
+ */
+void ARNETWORK_Sender_PreciseWait (ARNETWORK_SenderLane_t *lanePtr, int64_t waitTimeUs);
+
+/**
+ * @brief compute the time between two dates
+ * @param[in] startTime first date
+ * @param[in] endTime second date
+ * @return the time between the dates in microsecond
+ */
+int64_t ARNETWORK_Sender_ComputeTimespecUsTimeDiff (const struct timespec *startTime, const struct timespec *endTime);
+
+/**
+ * @brief pause or resume a flow-controlled input buffer according to the free cells advertised by the remote output buffer
+ * @warning the input buffer must be locked
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] numberOfFreeCells number of free cells advertised by the remote output buffer
+ */
+void ARNETWORK_Sender_ManageFlowControl (ARNETWORK_IOBuffer_t *inputBufferPtr, int numberOfFreeCells);
+
 void ARNETWORK_Sender_ManageIOBufferIsInRemovingStatus(ARNETWORK_IOBuffer_t *inputBufferPtr, eARNETWORK_MANAGER_CALLBACK_STATUS callbackStatus);
 
 /*****************************************
@@ -126,6 +262,9 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
     /** local declarations */
     ARNETWORK_Sender_t* senderPtr =  NULL;
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    int inputBufferIndex = 0;
+    int laneIndex = 0;
+    ARNETWORK_SenderLane_t *lanePtr = NULL;
 
     /** Create the sender */
     senderPtr =  malloc (sizeof (ARNETWORK_Sender_t));
@@ -151,7 +290,13 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
             senderPtr->inputBufferPtrMap = inputBufferPtrMap;
             senderPtr->minimumTimeBetweenSendsMs = ARNETWORK_SENDER_MILLISECOND;
             senderPtr->isPingRunning = 0;
-            senderPtr->hadARNetworkALOverflowOnPreviousRun = 0;
+            senderPtr->alBytesPushed = 0;
+            senderPtr->alDrainRate = 0;
+            ARSAL_Time_GetTime(&(senderPtr->lastSendTime));
+            senderPtr->sendCoalescingWindowUs = 0;
+            senderPtr->hasPendingUrgentFrame = 0;
+            senderPtr->nbFramesPushed = 0;
+            senderPtr->nbSends = 0;
             if (pingDelayMs == 0)
             {
                 senderPtr->minTimeBetweenPings = ARNETWORK_SENDER_MINIMUM_TIME_BETWEEN_PINGS_MS;
@@ -161,23 +306,63 @@ ARNETWORK_Sender_t* ARNETWORK_Sender_New (ARNETWORKAL_Manager_t *networkALManage
                 senderPtr->minTimeBetweenPings = pingDelayMs;
             }
             ARSAL_Time_GetTime(&(senderPtr->pingStartTime));
+
+            /** one lane per lane index used by the input buffers, the lane 0 always exists */
+            senderPtr->numberOfLanes = 1;
+            for (inputBufferIndex = 0; inputBufferIndex < senderPtr->numberOfInputBuff; ++inputBufferIndex)
+            {
+                if (senderPtr->inputBufferPtrArr[inputBufferIndex]->senderLane >= senderPtr->numberOfLanes)
+                {
+                    senderPtr->numberOfLanes = senderPtr->inputBufferPtrArr[inputBufferIndex]->senderLane + 1;
+                }
+            }
+        }
+        else
+        {
+            senderPtr->numberOfLanes = 0;
         }
 
-        /* Create the mutex/condition */
-        if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Mutex_Init (&(senderPtr->nextSendMutex)) != 0))
+        /* Create the lanes */
+        senderPtr->laneArr = NULL;
+        if (error == ARNETWORK_OK)
         {
-            error = ARNETWORK_ERROR_NEW_BUFFER;
+            senderPtr->laneArr = calloc (senderPtr->numberOfLanes, sizeof (ARNETWORK_SenderLane_t));
+            if (senderPtr->laneArr == NULL)
+            {
+                error = ARNETWORK_ERROR_ALLOC;
+            }
+        }
+
+        for (laneIndex = 0; (error == ARNETWORK_OK) && (laneIndex < senderPtr->numberOfLanes); ++laneIndex)
+        {
+            lanePtr = &(senderPtr->laneArr[laneIndex]);
+            lanePtr->senderPtr = senderPtr;
+            lanePtr->index = laneIndex;
+            lanePtr->hadARNetworkALOverflowOnPreviousRun = 0;
+            lanePtr->overflowWaitTimeMs = 0;
+            lanePtr->hasNewData = 0;
+
+            /* Create the mutex/condition */
+            if (ARSAL_Mutex_Init (&(lanePtr->nextSendMutex)) != 0)
+            {
+                error = ARNETWORK_ERROR_NEW_BUFFER;
+            }
+
+            if ( (error == ARNETWORK_OK) &&
+                 (ARSAL_Cond_Init (&(lanePtr->nextSendCond)) != 0))
+            {
+                error = ARNETWORK_ERROR_NEW_BUFFER;
+            }
         }
 
         if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Cond_Init (&(senderPtr->nextSendCond)) != 0))
+             (ARSAL_Mutex_Init (&(senderPtr->pingMutex)) != 0))
         {
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
 
         if ( (error == ARNETWORK_OK) &&
-             (ARSAL_Mutex_Init (&(senderPtr->pingMutex)) != 0))
+             (ARSAL_Mutex_Init (&(senderPtr->networkALMutex)) != 0))
         {
             error = ARNETWORK_ERROR_NEW_BUFFER;
         }
@@ -199,6 +384,7 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr)
 
     /** local declarations */
     ARNETWORK_Sender_t *senderPtr = NULL;
+    int laneIndex = 0;
 
     if (senderPtrAddr != NULL)
     {
@@ -206,9 +392,18 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr)
 
         if (senderPtr != NULL)
         {
-            ARSAL_Cond_Destroy (&(senderPtr->nextSendCond));
-            ARSAL_Mutex_Destroy (&(senderPtr->nextSendMutex));
+            if (senderPtr->laneArr != NULL)
+            {
+                for (laneIndex = 0; laneIndex < senderPtr->numberOfLanes; ++laneIndex)
+                {
+                    ARSAL_Cond_Destroy (&(senderPtr->laneArr[laneIndex].nextSendCond));
+                    ARSAL_Mutex_Destroy (&(senderPtr->laneArr[laneIndex].nextSendMutex));
+                }
+                free (senderPtr->laneArr);
+                senderPtr->laneArr = NULL;
+            }
             ARSAL_Mutex_Destroy (&(senderPtr->pingMutex));
+            ARSAL_Mutex_Destroy (&(senderPtr->networkALMutex));
 
             free (senderPtr);
             senderPtr = NULL;
@@ -223,6 +418,17 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
 
     /** local declarations */
     ARNETWORK_Sender_t *senderPtr = data;
+
+    return ARNETWORK_Sender_LaneThreadRun (&(senderPtr->laneArr[0]));
+}
+
+void* ARNETWORK_Sender_LaneThreadRun (void* data)
+{
+    /** -- Manage the sending of the data of the input buffers assigned to a sender lane -- */
+
+    /** local declarations */
+    ARNETWORK_SenderLane_t *lanePtr = data;
+    ARNETWORK_Sender_t *senderPtr = lanePtr->senderPtr;
     int inputBufferIndex = 0;
     ARNETWORK_IOBuffer_t *inputBufferPtrTemp = NULL; /**< pointer of the input buffer in processing */
     eARNETWORK_ERROR error = ARNETWORK_OK;
@@ -230,69 +436,48 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
     struct timespec now;
     struct timespec sleepStart;
     int sleepDurationMs = 0;
+    int64_t sleepDurationUs = 0;
+    int64_t sleepRemainderUs = 0;
+    int hasSlept = 0;
     int timeDiffMs;
+    int64_t coalescingRemainingTimeUs = 0;
+    int64_t preciseWaitTimeUs = 0;
+    int64_t scheduledWaitTimeUs = 0;
 
     while (senderPtr->isAlive)
     {
         waitTimeMs = 500;
+        preciseWaitTimeUs = -1;
+        hasSlept = 0;
+        __atomic_store_n (&(lanePtr->hasNewData), 0, __ATOMIC_RELAXED);
         for (inputBufferIndex = 0; inputBufferIndex < senderPtr->numberOfInputBuff && waitTimeMs > 0; ++inputBufferIndex)
         {
             inputBufferPtrTemp = senderPtr->inputBufferPtrArr[inputBufferIndex];
-            error = ARNETWORK_IOBuffer_Lock(inputBufferPtrTemp);
-            switch (inputBufferPtrTemp->dataType)
+            if (inputBufferPtrTemp->senderLane == lanePtr->index)
             {
-                // Low latency : no wait if any data available
-            case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                if ((error == ARNETWORK_OK) &&
-                    (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
-                {
-                    waitTimeMs = 0;
-                }
-                break;
-                // Acknowledged buffer :
-                //  - If waiting an ack, wait time = time before ack timeout
-                //  - If not waiting an ack and not empty, wait time = time before next send
-            case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+                error = ARNETWORK_IOBuffer_Lock(inputBufferPtrTemp);
                 if (error == ARNETWORK_OK)
                 {
-                    if (ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtrTemp))
-                    {
-                        if (inputBufferPtrTemp->ackWaitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->ackWaitTimeCount;
-                        }
-                    }
-                    else if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer))
-                    {
-                        if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
-                        {
-                            waitTimeMs = inputBufferPtrTemp->waitTimeCount;
-                        }
-                    }
-                }
-                break;
-                // All non Ack buffers
-                //  - 
-            default:
-                if ((error == ARNETWORK_OK) &&
-                    (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtrTemp->dataDescriptorRBuffer)))
-                {
-                    if (inputBufferPtrTemp->waitTimeCount < waitTimeMs)
+                    waitTimeMs = ARNETWORK_Sender_GetBufferWaitTimeMs (inputBufferPtrTemp, waitTimeMs);
+
+                    /** the nearest sending date of the lane is waited to the microsecond */
+                    scheduledWaitTimeUs = ARNETWORK_Sender_GetScheduledWaitTimeUs (inputBufferPtrTemp);
+                    if ((scheduledWaitTimeUs > 0) && ((preciseWaitTimeUs < 0) || (scheduledWaitTimeUs < preciseWaitTimeUs)))
                     {
-                        waitTimeMs = inputBufferPtrTemp->waitTimeCount;
+                        preciseWaitTimeUs = scheduledWaitTimeUs;
                     }
                 }
-                break;
+                ARNETWORK_IOBuffer_Unlock(inputBufferPtrTemp);
             }
-            ARNETWORK_IOBuffer_Unlock(inputBufferPtrTemp);
         }
         // Force a minimum wait time after an ARNetworkAL Overflow
-        if ((senderPtr->hadARNetworkALOverflowOnPreviousRun > 0) &&
-            (waitTimeMs < ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS))
+        if ((lanePtr->hadARNetworkALOverflowOnPreviousRun > 0) &&
+            (waitTimeMs < lanePtr->overflowWaitTimeMs))
         {
-            waitTimeMs = ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS;
+            waitTimeMs = lanePtr->overflowWaitTimeMs;
         }
-        senderPtr->hadARNetworkALOverflowOnPreviousRun = 0;
+        lanePtr->hadARNetworkALOverflowOnPreviousRun = 0;
+        lanePtr->overflowWaitTimeMs = 0;
 
         ARSAL_Time_GetTime(&sleepStart);
         if (waitTimeMs > 0)
@@ -301,72 +486,140 @@ void* ARNETWORK_Sender_ThreadRun (void* data)
             {
                 waitTimeMs = senderPtr->minimumTimeBetweenSendsMs;
             }
-            ARSAL_Mutex_Lock (&(senderPtr->nextSendMutex));
-            ARSAL_Cond_Timedwait (&(senderPtr->nextSendCond), &(senderPtr->nextSendMutex), waitTimeMs);
-            ARSAL_Mutex_Unlock (&(senderPtr->nextSendMutex));
+            // Do not hold the frames given to ARNetworkAL after the end of the coalescing window: it is waited to the microsecond, as the sending dates
+            ARSAL_Mutex_Lock (&(senderPtr->networkALMutex));
+            coalescingRemainingTimeUs = ARNETWORK_Sender_GetCoalescingRemainingTimeUs (senderPtr, &sleepStart);
+            ARSAL_Mutex_Unlock (&(senderPtr->networkALMutex));
+            if ((coalescingRemainingTimeUs >= 0) && ((preciseWaitTimeUs < 0) || (coalescingRemainingTimeUs < preciseWaitTimeUs)))
+            {
+                preciseWaitTimeUs = coalescingRemainingTimeUs;
+            }
+            // The timed wait, woken up by the new data, ends on the millisecond before the nearest event of the lane
+            if ((preciseWaitTimeUs >= 0) && (preciseWaitTimeUs < ((int64_t)waitTimeMs * 1000)))
+            {
+                waitTimeMs = (int)(preciseWaitTimeUs / 1000);
+            }
+
+            if (waitTimeMs > 0)
+            {
+                ARSAL_Mutex_Lock (&(lanePtr->nextSendMutex));
+                ARSAL_Cond_Timedwait (&(lanePtr->nextSendCond), &(lanePtr->nextSendMutex), waitTimeMs);
+                ARSAL_Mutex_Unlock (&(lanePtr->nextSendMutex));
+                hasSlept = 1;
+            }
+            else if (preciseWaitTimeUs > 0)
+            {
+                // The next event of the lane is less than a millisecond away: sleep until it, or until new data
+                ARNETWORK_Sender_PreciseWait (lanePtr, preciseWaitTimeUs);
+                hasSlept = 1;
+            }
         }
 
-        /** Process internal input buffers */
+        // The time slept is counted to the microsecond: the sleeps shorter than a millisecond are not lost by the wait time counters
         ARSAL_Time_GetTime(&now);
-        sleepDurationMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&sleepStart, &now);
-        ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
-        timeDiffMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(senderPtr->pingStartTime), &now);
-        /* Send only new pings if ping function is active (min time > 0) */
-        if (senderPtr->minTimeBetweenPings > 0)
+        sleepDurationMs = 0;
+        if (hasSlept)
         {
-            int maxWaitTime = senderPtr->minTimeBetweenPings;
-            if (ARNETWORK_SENDER_PING_TIMEOUT_MS > maxWaitTime)
-            {
-                maxWaitTime = ARNETWORK_SENDER_PING_TIMEOUT_MS;
-            }
+            sleepDurationUs = ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&sleepStart, &now) + sleepRemainderUs;
+            sleepDurationMs = (int)(sleepDurationUs / 1000);
+            sleepRemainderUs = sleepDurationUs % 1000;
+        }
 
-            /* Send new ping if :
-             *  -> DT > minTimeBetweenPings AND we're not waiting for a ping
-             *  -> DT > maxWaitTime
-             */
-            if (((senderPtr->isPingRunning == 0) &&
-                 (timeDiffMs > senderPtr->minTimeBetweenPings)) ||
-                (timeDiffMs > maxWaitTime))
+        /** Process internal input buffers */
+        if (lanePtr->index == 0)
+        {
+            ARSAL_Mutex_Lock (&(senderPtr->pingMutex));
+            timeDiffMs = ARSAL_Time_ComputeTimespecMsTimeDiff (&(senderPtr->pingStartTime), &now);
+            /* Send only new pings if ping function is active (min time > 0) */
+            if (senderPtr->minTimeBetweenPings > 0)
             {
-                if (timeDiffMs > ARNETWORK_SENDER_PING_TIMEOUT_MS)
+                int maxWaitTime = senderPtr->minTimeBetweenPings;
+                if (ARNETWORK_SENDER_PING_TIMEOUT_MS > maxWaitTime)
                 {
-                    senderPtr->lastPingValue = -1;
+                    maxWaitTime = ARNETWORK_SENDER_PING_TIMEOUT_MS;
                 }
-                inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING];
-                error = ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
-                if (error == ARNETWORK_OK) {
-                    ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, (uint8_t *)&now, sizeof (now), NULL, NULL, 1);
-                    ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
-                } else {
-                    ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "ARNETWORK_IOBuffer_Lock() failed; error: %s", ARNETWORK_Error_ToString (error));
+
+                /* Send new ping if :
+                 *  -> DT > minTimeBetweenPings AND we're not waiting for a ping
+                 *  -> DT > maxWaitTime
+                 */
+                if (((senderPtr->isPingRunning == 0) &&
+                     (timeDiffMs > senderPtr->minTimeBetweenPings)) ||
+                    (timeDiffMs > maxWaitTime))
+                {
+                    if (timeDiffMs > ARNETWORK_SENDER_PING_TIMEOUT_MS)
+                    {
+                        senderPtr->lastPingValue = -1;
+                    }
+                    inputBufferPtrTemp = senderPtr->inputBufferPtrMap[ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_PING];
+                    error = ARNETWORK_IOBuffer_Lock (inputBufferPtrTemp);
+                    if (error == ARNETWORK_OK) {
+                        ARNETWORK_IOBuffer_AddData (inputBufferPtrTemp, (uint8_t *)&now, sizeof (now), NULL, NULL, 1);
+                        ARNETWORK_IOBuffer_Unlock (inputBufferPtrTemp);
+                    } else {
+                        ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "ARNETWORK_IOBuffer_Lock() failed; error: %s", ARNETWORK_Error_ToString (error));
+                    }
+                    senderPtr->pingStartTime.tv_sec = now.tv_sec;
+                    senderPtr->pingStartTime.tv_nsec = now.tv_nsec;
+                    senderPtr->isPingRunning = 1;
                 }
-                senderPtr->pingStartTime.tv_sec = now.tv_sec;
-                senderPtr->pingStartTime.tv_nsec = now.tv_nsec;
-                senderPtr->isPingRunning = 1;
             }
-        }
 
-        ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+            ARSAL_Mutex_Unlock (&(senderPtr->pingMutex));
+        }
 
         for (inputBufferIndex = 0; inputBufferIndex < senderPtr->networkALManager->maxIds ; inputBufferIndex++)
         {
             inputBufferPtrTemp = senderPtr->inputBufferPtrMap[inputBufferIndex];
-            if (inputBufferPtrTemp != NULL)
+            if ((inputBufferPtrTemp != NULL) && (inputBufferPtrTemp->senderLane == lanePtr->index))
             {
-                ARNETWORK_Sender_ProcessBufferToSend (senderPtr, inputBufferPtrTemp, (waitTimeMs > 0) ? sleepDurationMs : 0);
+                ARNETWORK_Sender_ProcessBufferToSend (lanePtr, inputBufferPtrTemp, sleepDurationMs);
             }
         }
 
-        senderPtr->networkALManager->send(senderPtr->networkALManager);
+        /**
+         * send, unless the frames can be held until a next run without exceeding the coalescing window, and ARNetworkAL is not full.
+         * ARNetworkAL is shared by the lanes and the threads sending inline: the frames of all of them are sent.
+         */
+        ARSAL_Mutex_Lock (&(senderPtr->networkALMutex));
+        ARSAL_Time_GetTime(&now);
+        coalescingRemainingTimeUs = ARNETWORK_Sender_GetCoalescingRemainingTimeUs (senderPtr, &now);
+        if ((coalescingRemainingTimeUs <= 0) ||
+            (senderPtr->hasPendingUrgentFrame) ||
+            (lanePtr->hadARNetworkALOverflowOnPreviousRun))
+        {
+            ARNETWORK_Sender_SendAndMeasureDrainRate (senderPtr);
+        }
+        ARSAL_Mutex_Unlock (&(senderPtr->networkALMutex));
     }
 
     return NULL;
 }
 
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedMs)
+ARNETWORK_SenderLane_t* ARNETWORK_Sender_GetLane (ARNETWORK_Sender_t *senderPtr, int laneIndex)
+{
+    /** -- Gets a sender lane -- */
+
+    /** local declarations */
+    ARNETWORK_SenderLane_t *lanePtr = NULL;
+
+    if ((laneIndex >= 0) && (laneIndex < senderPtr->numberOfLanes))
+    {
+        lanePtr = &(senderPtr->laneArr[laneIndex]);
+    }
+
+    return lanePtr;
+}
+
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *buffer, int hasWaitedMs)
 {
+    ARNETWORK_Sender_t *senderPtr = lanePtr->senderPtr;
     eARNETWORK_MANAGER_CALLBACK_RETURN callbackReturn = ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
     eARNETWORK_ERROR error = ARNETWORK_OK;
+    int burstCount = 0;
+    int sendBurstSize = 0;
+    int maxNumberOfData = 0;
+    int numberOfDataSent = 0;
     /** lock the IOBuffer */
     error = ARNETWORK_IOBuffer_Lock(buffer);
 
@@ -385,6 +638,26 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
             }
         }
 
+        /** decrement the time to wait before sending to the full remote output buffer */
+        if ((buffer->flowControlWaitTimeCount > 0) && (hasWaitedMs > 0))
+        {
+            if (hasWaitedMs > buffer->flowControlWaitTimeCount)
+            {
+                buffer->flowControlWaitTimeCount = 0;
+            }
+            else
+            {
+                buffer->flowControlWaitTimeCount -= hasWaitedMs;
+            }
+        }
+
+        /** send the periodic data when due and allowed by the token bucket, independently of the data queued */
+        if ((ARNETWORK_IOBuffer_IsPeriodic (buffer)) && (ARNETWORK_IOBuffer_GetPeriodicWaitTimeMs (buffer) == 0) &&
+            (ARNETWORK_Sender_GetPeriodicRateLimitWaitTimeMs (buffer) == 0))
+        {
+            ARNETWORK_Sender_AddPeriodicToBuffer (senderPtr, lanePtr, buffer);
+        }
+
         if (ARNETWORK_IOBuffer_IsWaitAck (buffer))
         {
             /** decrement the time to wait before considering as a timeout */
@@ -400,7 +673,8 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
                 }
             }
 
-            if (buffer->ackWaitTimeCount == 0)
+            /** no retry while the remote output buffer is full */
+            if ((buffer->ackWaitTimeCount == 0) && (buffer->flowControlWaitTimeCount == 0))
             {
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] Timeout waiting for ack in buffer %d", senderPtr, buffer->ID);
                 if (buffer->retryCount == 0)
@@ -414,12 +688,12 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
                     ARNETWORK_Sender_ManageTimeOut (senderPtr, buffer, callbackReturn);
 
                 }
-                else
+                else if (ARNETWORK_Sender_GetRateLimitWaitTimeMs (buffer) == 0)
                 {
                     /** if there is a timeout, retry to send the data */
 
                     ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] Will retry sending data of buffer %d", senderPtr, buffer->ID);
-                    error = ARNETWORK_Sender_AddToBuffer (senderPtr, buffer, 1);
+                    error = ARNETWORK_Sender_AddToBuffer (senderPtr, lanePtr, buffer, 1);
                     if (error == ARNETWORK_OK)
                     {
                         /** reset the timeout counter*/
@@ -435,45 +709,31 @@ void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETW
             }
         }
 
-        else if ((!ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) && (buffer->waitTimeCount == 0))
+        else if ((!ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) && (buffer->waitTimeCount == 0) &&
+                 (buffer->flowControlWaitTimeCount == 0) &&
+                 (ARNETWORK_Sender_GetRateLimitWaitTimeMs (buffer) == 0))
         {
-            /** try to add the latest data of the input buffer in the sending buffer; callback with sent status */
-            if (ARNETWORK_Sender_AddToBuffer (senderPtr, buffer, 0) == ARNETWORK_OK)
+            /** send the latest data of the input buffer by batches, up to sendBurstSize data in this pass ; a sendBurstSize not set sends one data */
+            sendBurstSize = ((buffer->sendBurstSize > 0) || (buffer->sendBurstSize == ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER)) ? buffer->sendBurstSize : 1;
+            burstCount = 0;
+            do
+            {
+                maxNumberOfData = (sendBurstSize == ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER) ? ARNETWORK_SENDER_BATCH_SIZE_MAX : (sendBurstSize - burstCount);
+                error = ARNETWORK_Sender_AddBatchToBuffer (senderPtr, lanePtr, buffer, maxNumberOfData, &numberOfDataSent);
+                burstCount += numberOfDataSent;
+            }
+            while ((error == ARNETWORK_OK) &&
+                   (numberOfDataSent > 0) &&
+                   (!ARNETWORK_IOBuffer_IsWaitAck (buffer)) &&
+                   (lanePtr->hadARNetworkALOverflowOnPreviousRun == 0) &&
+                   ((sendBurstSize == ARNETWORK_IOBUFFERPARAM_INFINITE_NUMBER) || (burstCount < sendBurstSize)) &&
+                   (!ARNETWORK_RingBuffer_IsEmpty (buffer->dataDescriptorRBuffer)) &&
+                   (ARNETWORK_Sender_GetRateLimitWaitTimeMs (buffer) == 0));
+
+            /** wait sendingWaitTimeMs after the burst */
+            if (burstCount > 0)
             {
                 buffer->waitTimeCount = buffer->sendingWaitTimeMs;
-
-                switch (buffer->dataType)
-                {
-                case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-                    /**
-                     * reinitialize the input buffer parameters,
-                     * save the sequence wait for the acknowledgement,
-                     * and pass on waiting acknowledgement.
-                     */
-                    buffer->isWaitAck = 1;
-                    buffer->ackWaitTimeCount = buffer->ackTimeoutMs;
-                    buffer->retryCount = buffer->numberOfRetry;
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_DATA:
-                    /** pop the data sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-                    /** pop the data sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                case ARNETWORKAL_FRAME_TYPE_ACK:
-                    /** pop the acknowledgement sent */
-                    ARNETWORK_IOBuffer_PopData (buffer);
-                    break;
-
-                default:
-                    ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] dataType: %d unknow \n", senderPtr, buffer->dataType);
-                    break;
-                }
             }
         }
 
@@ -488,12 +748,133 @@ void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr)
     senderPtr->isAlive = 0;
 }
 
-void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr)
+void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** the flag ends the sleep of the lane before a sending date, which does not wait the condition */
+    __atomic_store_n (&(senderPtr->laneArr[inputBufferPtr->senderLane].hasNewData), 1, __ATOMIC_RELEASE);
+    ARSAL_Cond_Signal (&(senderPtr->laneArr[inputBufferPtr->senderLane].nextSendCond));
+}
+
+int ARNETWORK_Sender_TrySendInline (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy)
 {
-    ARSAL_Cond_Signal (&(senderPtr->nextSendCond));
+    /** -- Try to send a data of an input buffer from the calling thread, without copying it in the input buffer -- */
+
+    /** local declarations */
+    int isSent = 0;
+    int isHeld = 0;
+    eARNETWORKAL_MANAGER_RETURN alStatus = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+    ARNETWORKAL_Frame_t frame = {
+        .type = 0,
+        .id = 0,
+        .seq = 0,
+        .size = 0,
+        .dataPtr = NULL,
+    };
+
+    frame.type = inputBufferPtr->dataType;
+    frame.id = inputBufferPtr->ID;
+    frame.seq = inputBufferPtr->seq + 1;
+    frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + dataSize;
+    frame.dataPtr = data;
+
+    /**
+     * send inline only:
+     *  - the data of a data or low latency data input buffer (the acknowledged data wait for their acknowledgement in the sending thread)
+     *  - the data that the input buffer would accept (the errors are reported by the input buffer)
+     *  - the data of a data input buffer whose sending wait time is elapsed
+     *  - the data allowed by the token bucket
+     *  - if ARNetworkAL is not used by a sending thread
+     */
+    if ((frame.type != ARNETWORKAL_FRAME_TYPE_DATA) && (frame.type != ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY))
+    {
+        return 0;
+    }
+
+    if ((doDataCopy) && ((!ARNETWORK_IOBuffer_CanCopyData(inputBufferPtr)) || ((unsigned int)dataSize > inputBufferPtr->dataCopyRBuffer->cellSize)))
+    {
+        return 0;
+    }
+
+    if ((frame.type == ARNETWORKAL_FRAME_TYPE_DATA) && (inputBufferPtr->waitTimeCount > 0))
+    {
+        return 0;
+    }
+
+    if (ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs (inputBufferPtr, frame.size) != 0)
+    {
+        return 0;
+    }
+
+    if (ARSAL_Mutex_Trylock (&(senderPtr->networkALMutex)) != 0)
+    {
+        return 0;
+    }
+
+    if ((inputBufferPtr->alHeadroomSize == 0) ||
+        (senderPtr->alBytesPushed + frame.size + inputBufferPtr->alHeadroomSize <= senderPtr->networkALManager->maxBufferSize))
+    {
+        alStatus = senderPtr->networkALManager->pushFrame (senderPtr->networkALManager, &frame);
+    }
+    else
+    {
+        alStatus = ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL;
+    }
+
+    if (alStatus == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+    {
+        inputBufferPtr->seq = frame.seq;
+        if ((senderPtr->alBytesPushed == 0) && (senderPtr->sendCoalescingWindowUs > 0))
+        {
+            ARSAL_Time_GetTime(&(senderPtr->firstPushTime));
+        }
+        senderPtr->alBytesPushed += frame.size;
+        senderPtr->nbFramesPushed++;
+        ARNETWORK_IOBuffer_ConsumeRateLimitTokens (inputBufferPtr, frame.size);
+
+        if (frame.type == ARNETWORKAL_FRAME_TYPE_DATA)
+        {
+            inputBufferPtr->waitTimeCount = inputBufferPtr->sendingWaitTimeMs;
+        }
+
+        /** send the frame with the frames held by ARNetworkAL ; a data can be held until the end of the send coalescing window */
+        if ((frame.type == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) || (senderPtr->sendCoalescingWindowUs == 0))
+        {
+            ARNETWORK_Sender_SendAndMeasureDrainRate (senderPtr);
+        }
+        else
+        {
+            isHeld = 1;
+        }
+        isSent = 1;
+    }
+    /** No else: the data will be sent by the sending thread */
+
+    ARSAL_Mutex_Unlock (&(senderPtr->networkALMutex));
+
+    if (isHeld)
+    {
+        /** the sending thread sends the held frames at the end of the send coalescing window */
+        ARNETWORK_Sender_SignalNewData (senderPtr, inputBufferPtr);
+    }
+
+    if (isSent)
+    {
+        /** callback with sent, free and done status */
+        if (callback != NULL)
+        {
+            callback (inputBufferPtr->ID, data, customData, ARNETWORK_MANAGER_CALLBACK_STATUS_SENT);
+            if (!doDataCopy)
+            {
+                callback (inputBufferPtr->ID, data, customData, ARNETWORK_MANAGER_CALLBACK_STATUS_FREE);
+            }
+            callback (inputBufferPtr->ID, NULL, customData, ARNETWORK_MANAGER_CALLBACK_STATUS_DONE);
+        }
+    }
+
+    return isSent;
 }
 
-eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber)
+eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber, int numberOfFreeCells)
 {
     /** -- Receive an acknowledgment fo a data -- */
 
@@ -516,11 +897,17 @@ eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, in
              */
             error = ARNETWORK_IOBuffer_AckReceived (inputBufferPtr, seqNumber);
 
+            /** the free cells are advertised also by the acknowledgments of the data refused and by the window updates */
+            if ((inputBufferPtr->isFlowControlled) && (numberOfFreeCells >= 0))
+            {
+                ARNETWORK_Sender_ManageFlowControl (inputBufferPtr, numberOfFreeCells);
+            }
+
             /** unlock the IOBuffer */
             ARNETWORK_IOBuffer_Unlock (inputBufferPtr);
 
             /* Wake up the send thread to update the wait time of buffers */
-            ARNETWORK_Sender_SignalNewData (senderPtr);
+            ARNETWORK_Sender_SignalNewData (senderPtr, inputBufferPtr);
         }
     }
     else
@@ -576,13 +963,14 @@ void ARNETWORK_Sender_Reset (ARNETWORK_Sender_t *senderPtr)
  *
  *****************************************/
 
-eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int isRetry)
+eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int isRetry)
 {
     /** -- add data to the sender buffer and callback with sent status -- */
 
     /** local declarations */
     eARNETWORK_ERROR error = ARNETWORK_OK;
     ARNETWORK_DataDescriptor_t dataDescriptor;
+    int waitTimeMs = 0;
 
     /** pop data descriptor*/
     error = ARNETWORK_RingBuffer_Front (inputBufferPtr->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor);
@@ -605,10 +993,15 @@ eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, AR
         frame.seq = inputBufferPtr->seq;
         frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + dataDescriptor.dataSize;
         frame.dataPtr = dataDescriptor.data;
-        eARNETWORKAL_MANAGER_RETURN alStatus = senderPtr->networkALManager->pushFrame(senderPtr->networkALManager, &frame);
+        eARNETWORKAL_MANAGER_RETURN alStatus = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+
+        ARNETWORK_Sender_PushFrames (senderPtr, inputBufferPtr, &frame, 1, 0, &alStatus, &waitTimeMs);
+
         switch(alStatus)
         {
         case ARNETWORKAL_MANAGER_RETURN_DEFAULT:
+            ARNETWORK_IOBuffer_ConsumeRateLimitTokens (inputBufferPtr, frame.size);
+
             /** callback with sent status */
             if (dataDescriptor.callback != NULL)
             {
@@ -620,22 +1013,7 @@ eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, AR
             }
             break;
         case ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL:
-            senderPtr->hadARNetworkALOverflowOnPreviousRun = 1;
-            ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_SENDER_TAG, "[%p] Not enough space to send a packet of type %d, size %d, for buffer %d", senderPtr, frame.type, frame.size, frame.id);
-            switch (inputBufferPtr->dataType)
-            {
-            case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
-            case ARNETWORKAL_FRAME_TYPE_ACK:
-                // Keep acks and ack data, report an error
-                error = ARNETWORK_ERROR_BUFFER_SIZE;
-                break;
-            case ARNETWORKAL_FRAME_TYPE_DATA:
-            case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
-            default:
-                // Discard non ack data and low latency data, report "ok"
-                error = ARNETWORK_OK;
-                break;
-            }
+            error = ARNETWORK_Sender_ManageOverflow (senderPtr, lanePtr, inputBufferPtr, &frame, waitTimeMs);
             break;
         default:
                 ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] pushFrame returned an unexpected status : %d", senderPtr, alStatus);
@@ -647,6 +1025,608 @@ eARNETWORK_ERROR ARNETWORK_Sender_AddToBuffer (ARNETWORK_Sender_t *senderPtr, AR
     return error;
 }
 
+eARNETWORK_ERROR ARNETWORK_Sender_AddBatchToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, int maxNumberOfData, int *numberOfDataSentPtr)
+{
+    /** -- add a batch of data to the sender buffer and callback with sent status -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    ARNETWORK_DataDescriptor_t dataDescriptorArr[ARNETWORK_SENDER_BATCH_SIZE_MAX];
+    ARNETWORKAL_Frame_t frameArr[ARNETWORK_SENDER_BATCH_SIZE_MAX];
+    uint8_t *dataDescriptorPtr = NULL;
+    int numberOfFrames = 0;
+    int numberOfPushedFrames = 0;
+    int frameIndex = 0;
+    int frameSize = 0;
+    int waitTimeMs = 0;
+    int hasScheduledData = 0;
+    struct timespec now;
+    eARNETWORKAL_MANAGER_RETURN alStatus = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+
+    *numberOfDataSentPtr = 0;
+    ARSAL_Time_GetTime(&now);
+
+    if (maxNumberOfData > ARNETWORK_SENDER_BATCH_SIZE_MAX)
+    {
+        maxNumberOfData = ARNETWORK_SENDER_BATCH_SIZE_MAX;
+    }
+    /** an acknowledged data is sent alone, the next one waits its acknowledgement */
+    if (inputBufferPtr->dataType == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+    {
+        maxNumberOfData = 1;
+    }
+
+    /**
+     * collect the frames of the latest data, as long as the token bucket allows them ; the tokens are given back if the frame is not sent.
+     * a data scheduled later stops the batch: the data queued after it wait its sending.
+     * a canceled data stops the batch too: it is popped without being sent once the data before it are popped.
+     */
+    while (numberOfFrames < maxNumberOfData)
+    {
+        dataDescriptorPtr = ARNETWORK_RingBuffer_GetDataPtr (inputBufferPtr->dataDescriptorRBuffer, numberOfFrames);
+        if (dataDescriptorPtr == NULL)
+        {
+            break;
+        }
+        memcpy (&(dataDescriptorArr[numberOfFrames]), dataDescriptorPtr, sizeof (ARNETWORK_DataDescriptor_t));
+
+        if ((dataDescriptorArr[numberOfFrames].isCanceled) ||
+            (ARNETWORK_IOBuffer_GetDataSendWaitTimeUs (&(dataDescriptorArr[numberOfFrames]), &now) > 0))
+        {
+            break;
+        }
+        hasScheduledData |= dataDescriptorArr[numberOfFrames].hasSendTime;
+
+        frameSize = offsetof (ARNETWORKAL_Frame_t, dataPtr) + dataDescriptorArr[numberOfFrames].dataSize;
+        if (ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs (inputBufferPtr, frameSize) != 0)
+        {
+            break;
+        }
+        ARNETWORK_IOBuffer_ConsumeRateLimitTokens (inputBufferPtr, frameSize);
+
+        frameArr[numberOfFrames].type = inputBufferPtr->dataType;
+        frameArr[numberOfFrames].id = inputBufferPtr->ID;
+        frameArr[numberOfFrames].seq = inputBufferPtr->seq + 1 + numberOfFrames;
+        frameArr[numberOfFrames].size = frameSize;
+        frameArr[numberOfFrames].dataPtr = dataDescriptorArr[numberOfFrames].data;
+        ++numberOfFrames;
+    }
+
+    if (numberOfFrames == 0)
+    {
+        return error;
+    }
+
+    /** a scheduled data is sent on time, it is not held by the send coalescing window */
+    numberOfPushedFrames = ARNETWORK_Sender_PushFrames (senderPtr, inputBufferPtr, frameArr, numberOfFrames, hasScheduledData, &alStatus, &waitTimeMs);
+
+    /** the frames given to ARNetworkAL and the first frame refused use a sequence number */
+    inputBufferPtr->seq = frameArr[(numberOfPushedFrames < numberOfFrames) ? numberOfPushedFrames : (numberOfFrames - 1)].seq;
+    for (frameIndex = numberOfPushedFrames; frameIndex < numberOfFrames; ++frameIndex)
+    {
+        ARNETWORK_IOBuffer_RefundRateLimitTokens (inputBufferPtr, frameArr[frameIndex].size);
+    }
+
+    /** map the result of the batch to each data, in order */
+    for (frameIndex = 0; frameIndex < numberOfPushedFrames; ++frameIndex)
+    {
+        /** callback with sent status */
+        if (dataDescriptorArr[frameIndex].callback != NULL)
+        {
+            if (frameArr[frameIndex].type == ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK)
+            {
+                ARSAL_PRINT(ARSAL_PRINT_DEBUG, ARNETWORK_SENDER_TAG, "[%p] Will send ack command : project = %X | class = %X | command = %X - %X", senderPtr, frameArr[frameIndex].dataPtr[0], frameArr[frameIndex].dataPtr[1], frameArr[frameIndex].dataPtr[2], frameArr[frameIndex].dataPtr[3]);
+            }
+            dataDescriptorArr[frameIndex].callback (inputBufferPtr->ID, dataDescriptorArr[frameIndex].data, dataDescriptorArr[frameIndex].customData, ARNETWORK_MANAGER_CALLBACK_STATUS_SENT);
+        }
+
+        switch (inputBufferPtr->dataType)
+        {
+        case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+            /**
+             * reinitialize the input buffer parameters,
+             * save the sequence wait for the acknowledgement,
+             * and pass on waiting acknowledgement.
+             */
+            inputBufferPtr->isWaitAck = 1;
+            inputBufferPtr->ackWaitTimeCount = inputBufferPtr->ackTimeoutMs;
+            inputBufferPtr->retryCount = inputBufferPtr->numberOfRetry;
+            break;
+
+        case ARNETWORKAL_FRAME_TYPE_DATA:
+        case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+        case ARNETWORKAL_FRAME_TYPE_ACK:
+            /** pop the data sent */
+            ARNETWORK_IOBuffer_PopData (inputBufferPtr);
+            break;
+
+        default:
+            ARSAL_PRINT (ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] dataType: %d unknow \n", senderPtr, inputBufferPtr->dataType);
+            break;
+        }
+    }
+    *numberOfDataSentPtr = numberOfPushedFrames;
+
+    switch (alStatus)
+    {
+    case ARNETWORKAL_MANAGER_RETURN_DEFAULT:
+        break;
+    case ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL:
+        error = ARNETWORK_Sender_ManageOverflow (senderPtr, lanePtr, inputBufferPtr, &(frameArr[numberOfPushedFrames]), waitTimeMs);
+        if (error == ARNETWORK_OK)
+        {
+            /** pop the data dropped */
+            ARNETWORK_IOBuffer_PopData (inputBufferPtr);
+            ++(*numberOfDataSentPtr);
+        }
+        break;
+    default:
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] pushFrame returned an unexpected status : %d", senderPtr, alStatus);
+        error = ARNETWORK_ERROR;
+        break;
+    }
+
+    return error;
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_AddPeriodicToBuffer (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- add the periodic data of an input buffer to the sender buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_MANAGER_RETURN alStatus = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+    int waitTimeMs = 0;
+    ARNETWORKAL_Frame_t frame = {
+        .type = 0,
+        .id = 0,
+        .seq = 0,
+        .size = 0,
+        .dataPtr = NULL,
+    };
+
+    /** update the periodic data in place */
+    if (inputBufferPtr->periodicUpdateCallback != NULL)
+    {
+        inputBufferPtr->periodicUpdateCallback (inputBufferPtr->ID, inputBufferPtr->periodicData, &(inputBufferPtr->periodicDataSize), inputBufferPtr->periodicDataCapacity, inputBufferPtr->periodicCustomData);
+        if (inputBufferPtr->periodicDataSize > inputBufferPtr->periodicDataCapacity)
+        {
+            inputBufferPtr->periodicDataSize = inputBufferPtr->periodicDataCapacity;
+        }
+    }
+
+    frame.type = inputBufferPtr->dataType;
+    frame.id = inputBufferPtr->ID;
+    frame.seq = inputBufferPtr->seq + 1;
+    frame.size = offsetof (ARNETWORKAL_Frame_t, dataPtr) + inputBufferPtr->periodicDataSize;
+    frame.dataPtr = inputBufferPtr->periodicData;
+
+    if (ARNETWORK_Sender_PushFrames (senderPtr, inputBufferPtr, &frame, 1, 0, &alStatus, &waitTimeMs) == 1)
+    {
+        inputBufferPtr->seq = frame.seq;
+        ARNETWORK_IOBuffer_ConsumeRateLimitTokens (inputBufferPtr, frame.size);
+        ARNETWORK_IOBuffer_SchedulePeriodicData (inputBufferPtr);
+    }
+    else if (alStatus == ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL)
+    {
+        /** a dropped periodic data waits its next period, a kept one is sent in a next run */
+        error = ARNETWORK_Sender_ManageOverflow (senderPtr, lanePtr, inputBufferPtr, &frame, waitTimeMs);
+        if (error == ARNETWORK_OK)
+        {
+            ARNETWORK_IOBuffer_SchedulePeriodicData (inputBufferPtr);
+        }
+    }
+    else
+    {
+        ARSAL_PRINT(ARSAL_PRINT_ERROR, ARNETWORK_SENDER_TAG, "[%p] pushFrame returned an unexpected status : %d", senderPtr, alStatus);
+        error = ARNETWORK_ERROR;
+        ARNETWORK_IOBuffer_SchedulePeriodicData (inputBufferPtr);
+    }
+
+    return error;
+}
+
+int ARNETWORK_Sender_PushFrames (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, ARNETWORKAL_Frame_t *frameArr, int numberOfFrames, int isUrgent, eARNETWORKAL_MANAGER_RETURN *alStatusPtr, int *overflowWaitTimeMsPtr)
+{
+    /** -- give frames to ARNetworkAL, in one hold of ARNetworkAL -- */
+
+    /** local declarations */
+    eARNETWORKAL_MANAGER_RETURN alStatus = ARNETWORKAL_MANAGER_RETURN_DEFAULT;
+    ARNETWORKAL_Frame_t *frame = NULL;
+    int numberOfPushedFrames = 0;
+
+    /** ARNetworkAL is shared by the lanes: only hold it while giving the frames, the callbacks are called without it */
+    ARSAL_Mutex_Lock (&(senderPtr->networkALMutex));
+
+    while ((numberOfPushedFrames < numberOfFrames) && (alStatus == ARNETWORKAL_MANAGER_RETURN_DEFAULT))
+    {
+        frame = &(frameArr[numberOfPushedFrames]);
+
+        /** a data which would use the headroom left for the other buffers is handled as an overflow */
+        if ((inputBufferPtr->alHeadroomSize > 0) &&
+            (senderPtr->alBytesPushed + frame->size + inputBufferPtr->alHeadroomSize > senderPtr->networkALManager->maxBufferSize))
+        {
+            alStatus = ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL;
+        }
+        else
+        {
+            alStatus = senderPtr->networkALManager->pushFrame(senderPtr->networkALManager, frame);
+        }
+
+        if (alStatus == ARNETWORKAL_MANAGER_RETURN_DEFAULT)
+        {
+            if ((senderPtr->alBytesPushed == 0) && (senderPtr->sendCoalescingWindowUs > 0))
+            {
+                ARSAL_Time_GetTime(&(senderPtr->firstPushTime));
+            }
+            senderPtr->alBytesPushed += frame->size;
+            senderPtr->nbFramesPushed++;
+            /** the acknowledgements, pings and pongs are not held: holding them would delay the ack timeouts and the latency measures of the remote device */
+            if ((isUrgent) ||
+                (frame->type == ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY) ||
+                (frame->type == ARNETWORKAL_FRAME_TYPE_ACK) ||
+                (inputBufferPtr->ID < ARNETWORK_MANAGER_INTERNAL_BUFFER_ID_MAX))
+            {
+                senderPtr->hasPendingUrgentFrame = 1;
+            }
+            ++numberOfPushedFrames;
+        }
+    }
+
+    if (alStatus == ARNETWORKAL_MANAGER_RETURN_BUFFER_FULL)
+    {
+        *overflowWaitTimeMsPtr = ARNETWORK_Sender_GetOverflowWaitTimeMs (senderPtr, inputBufferPtr);
+    }
+
+    ARSAL_Mutex_Unlock (&(senderPtr->networkALMutex));
+
+    *alStatusPtr = alStatus;
+    return numberOfPushedFrames;
+}
+
+eARNETWORK_ERROR ARNETWORK_Sender_ManageOverflow (ARNETWORK_Sender_t *senderPtr, ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *inputBufferPtr, const ARNETWORKAL_Frame_t *frame, int waitTimeMs)
+{
+    /** -- handle the overflow of ARNetworkAL on a data of an input buffer -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+
+    lanePtr->hadARNetworkALOverflowOnPreviousRun = 1;
+    if (waitTimeMs > lanePtr->overflowWaitTimeMs)
+    {
+        lanePtr->overflowWaitTimeMs = waitTimeMs;
+    }
+    inputBufferPtr->nbOverflows++;
+    switch (inputBufferPtr->dataType)
+    {
+    case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+    case ARNETWORKAL_FRAME_TYPE_ACK:
+        // Keep acks and ack data, report an error
+        error = ARNETWORK_ERROR_BUFFER_SIZE;
+        break;
+    case ARNETWORKAL_FRAME_TYPE_DATA:
+    case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+    default:
+        if (inputBufferPtr->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_KEEP)
+        {
+            // Keep the data for a next run, report an error
+            error = ARNETWORK_ERROR_BUFFER_SIZE;
+        }
+        else
+        {
+            // Discard non ack data and low latency data, report "ok"
+            inputBufferPtr->nbDrops++;
+            error = ARNETWORK_OK;
+        }
+        break;
+    }
+    ARSAL_PRINT(ARSAL_PRINT_WARNING, ARNETWORK_SENDER_TAG, "[%p] Not enough space to send a packet of type %d, size %d, for buffer %d (%s)", senderPtr, frame->type, frame->size, frame->id, (error == ARNETWORK_OK) ? "dropped" : "kept");
+
+    return error;
+}
+
+int ARNETWORK_Sender_GetBufferWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr, int maxWaitTimeMs)
+{
+    /** -- get the time to wait before the next processing of an input buffer -- */
+
+    /** local declarations */
+    int waitTimeMs = maxWaitTimeMs;
+    int rateLimitWaitTimeMs = 0;
+    int periodicWaitTimeMs = 0;
+    int dataWaitTimeMs = 0;
+    int ackWaitTimeMs = 0;
+    int64_t scheduledWaitTimeUs = 0;
+
+    // Time before next send, or before the sending date of the front data if it is later
+    //  - The sending date is rounded up to the millisecond here ; ARNETWORK_Sender_LaneThreadRun() waits it precisely
+    dataWaitTimeMs = inputBufferPtr->waitTimeCount;
+    scheduledWaitTimeUs = ARNETWORK_Sender_GetScheduledWaitTimeUs (inputBufferPtr);
+    if (((scheduledWaitTimeUs + 999) / 1000) > dataWaitTimeMs)
+    {
+        dataWaitTimeMs = (int)((scheduledWaitTimeUs + 999) / 1000);
+    }
+
+    switch (inputBufferPtr->dataType)
+    {
+        // Low latency : no wait if any data available, except the time before next send
+        //  - The time before next send is only counted down when the sender waits
+    case ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY:
+        if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtr->dataDescriptorRBuffer))
+        {
+            waitTimeMs = (dataWaitTimeMs < waitTimeMs) ? dataWaitTimeMs : waitTimeMs;
+        }
+        break;
+        // Acknowledged buffer :
+        //  - If waiting an ack, wait time = time before ack timeout
+        //  - If not waiting an ack and not empty, wait time = time before next send
+    case ARNETWORKAL_FRAME_TYPE_DATA_WITH_ACK:
+        //  - If the remote output buffer is full, wait at least the time before the end of the pause
+        if (ARNETWORK_IOBuffer_IsWaitAck(inputBufferPtr))
+        {
+            ackWaitTimeMs = (inputBufferPtr->ackWaitTimeCount > inputBufferPtr->flowControlWaitTimeCount) ? inputBufferPtr->ackWaitTimeCount : inputBufferPtr->flowControlWaitTimeCount;
+            if (ackWaitTimeMs < waitTimeMs)
+            {
+                waitTimeMs = ackWaitTimeMs;
+            }
+        }
+        else if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtr->dataDescriptorRBuffer))
+        {
+            if (inputBufferPtr->flowControlWaitTimeCount > dataWaitTimeMs)
+            {
+                dataWaitTimeMs = inputBufferPtr->flowControlWaitTimeCount;
+            }
+            if (dataWaitTimeMs < waitTimeMs)
+            {
+                waitTimeMs = dataWaitTimeMs;
+            }
+        }
+        break;
+        // All non Ack buffers
+        //  - If not empty, wait time = time before next send
+    default:
+        if (!ARNETWORK_RingBuffer_IsEmpty (inputBufferPtr->dataDescriptorRBuffer))
+        {
+            if (dataWaitTimeMs < waitTimeMs)
+            {
+                waitTimeMs = dataWaitTimeMs;
+            }
+        }
+        break;
+    }
+
+    // Periodic data : wait time = time before its next sending
+    //  - A periodic data due waits the token bucket
+    if (ARNETWORK_IOBuffer_IsPeriodic (inputBufferPtr))
+    {
+        periodicWaitTimeMs = ARNETWORK_IOBuffer_GetPeriodicWaitTimeMs (inputBufferPtr);
+        if (periodicWaitTimeMs == 0)
+        {
+            periodicWaitTimeMs = ARNETWORK_Sender_GetPeriodicRateLimitWaitTimeMs (inputBufferPtr);
+        }
+        if (periodicWaitTimeMs < waitTimeMs)
+        {
+            waitTimeMs = periodicWaitTimeMs;
+        }
+    }
+
+    // The token bucket can delay the next send of a buffer with pending data
+    if ((waitTimeMs < maxWaitTimeMs) && (ARNETWORK_IOBuffer_IsRateLimited (inputBufferPtr)))
+    {
+        rateLimitWaitTimeMs = ARNETWORK_Sender_GetRateLimitWaitTimeMs (inputBufferPtr);
+        if (rateLimitWaitTimeMs > waitTimeMs)
+        {
+            waitTimeMs = (rateLimitWaitTimeMs < maxWaitTimeMs) ? rateLimitWaitTimeMs : maxWaitTimeMs;
+        }
+    }
+
+    return waitTimeMs;
+}
+
+int ARNETWORK_Sender_GetRateLimitWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- get the time to wait before the token bucket allows to send the next data -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t dataDescriptor;
+    int waitTimeMs = 0;
+
+    if ((ARNETWORK_IOBuffer_IsRateLimited (inputBufferPtr)) &&
+        (ARNETWORK_RingBuffer_Front (inputBufferPtr->dataDescriptorRBuffer, (uint8_t*) &dataDescriptor) == ARNETWORK_OK))
+    {
+        /** the cost of the data is the size of the frame given to ARNetworkAL */
+        waitTimeMs = ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs (inputBufferPtr, offsetof (ARNETWORKAL_Frame_t, dataPtr) + dataDescriptor.dataSize);
+    }
+
+    return waitTimeMs;
+}
+
+int ARNETWORK_Sender_GetPeriodicRateLimitWaitTimeMs (ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- get the time to wait before the token bucket allows to send the periodic data of the input buffer -- */
+
+    /** local declarations */
+    int waitTimeMs = 0;
+
+    if ((ARNETWORK_IOBuffer_IsRateLimited (inputBufferPtr)) && (ARNETWORK_IOBuffer_IsPeriodic (inputBufferPtr)))
+    {
+        /** the periodic data shares the token bucket of the data queued ; its cost is the size of its last sending */
+        waitTimeMs = ARNETWORK_IOBuffer_GetRateLimitWaitTimeMs (inputBufferPtr, offsetof (ARNETWORKAL_Frame_t, dataPtr) + inputBufferPtr->periodicDataSize);
+    }
+
+    return waitTimeMs;
+}
+
+int64_t ARNETWORK_Sender_GetScheduledWaitTimeUs (ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- get the time to wait before the sending date of the front data of the input buffer -- */
+
+    /** local declarations */
+    ARNETWORK_DataDescriptor_t *dataDescriptorPtr = NULL;
+    struct timespec now;
+    int64_t waitTimeUs = 0;
+
+    /** the front data of an input buffer waiting an acknowledgement is already sent */
+    if (!ARNETWORK_IOBuffer_IsWaitAck (inputBufferPtr))
+    {
+        dataDescriptorPtr = (ARNETWORK_DataDescriptor_t *) ARNETWORK_RingBuffer_GetDataPtr (inputBufferPtr->dataDescriptorRBuffer, 0);
+        if ((dataDescriptorPtr != NULL) && (dataDescriptorPtr->hasSendTime))
+        {
+            ARSAL_Time_GetTime(&now);
+            waitTimeUs = ARNETWORK_IOBuffer_GetDataSendWaitTimeUs (dataDescriptorPtr, &now);
+        }
+    }
+
+    return waitTimeUs;
+}
+
+void ARNETWORK_Sender_SendAndMeasureDrainRate (ARNETWORK_Sender_t *senderPtr)
+{
+    /** -- send the data given to ARNetworkAL and update the estimation of its drain rate -- */
+
+    /** local declarations */
+    struct timespec now;
+    int64_t intervalUs = 0;
+    int drainRate = 0;
+
+    senderPtr->networkALManager->send(senderPtr->networkALManager);
+
+    if (senderPtr->alBytesPushed > 0)
+    {
+        senderPtr->nbSends++;
+
+        /** the drain rate is the number of bytes sent over the time since the previous send, not the duration of the send() call which only copies the data to the system */
+        ARSAL_Time_GetTime(&now);
+        intervalUs = ((int64_t)(now.tv_sec - senderPtr->lastSendTime.tv_sec) * 1000000) + ((now.tv_nsec - senderPtr->lastSendTime.tv_nsec) / 1000);
+        senderPtr->lastSendTime = now;
+    }
+
+    /** an interval including a time without data to send does not measure the drain rate */
+    if ((senderPtr->alBytesPushed > 0) && (intervalUs <= (ARNETWORK_SENDER_DRAIN_RATE_MAX_INTERVAL_MS * 1000)))
+    {
+        if (intervalUs < 1)
+        {
+            intervalUs = 1;
+        }
+        drainRate = (int)(((int64_t)senderPtr->alBytesPushed * 1000) / intervalUs);
+        if (drainRate < 1)
+        {
+            drainRate = 1;
+        }
+
+        /** exponential moving average of the drain rate */
+        if (senderPtr->alDrainRate == 0)
+        {
+            senderPtr->alDrainRate = drainRate;
+        }
+        else
+        {
+            senderPtr->alDrainRate += (drainRate - senderPtr->alDrainRate) / ARNETWORK_SENDER_DRAIN_RATE_SMOOTHING;
+        }
+    }
+
+    senderPtr->alBytesPushed = 0;
+    senderPtr->hasPendingUrgentFrame = 0;
+}
+
+void ARNETWORK_Sender_ManageFlowControl (ARNETWORK_IOBuffer_t *inputBufferPtr, int numberOfFreeCells)
+{
+    /** -- pause or resume a flow-controlled input buffer -- */
+
+    if (numberOfFreeCells == 0)
+    {
+        /** the remote output buffer is full: stop sending until it advertises a free cell, or until the end of the pause if the advertisement is lost */
+        inputBufferPtr->flowControlWaitTimeCount = (inputBufferPtr->ackTimeoutMs > 0) ? inputBufferPtr->ackTimeoutMs : ARNETWORK_SENDER_FLOW_CONTROL_WAIT_TIME_MS;
+
+        /** the data refused reached the remote device: the retries are not consumed while it is full */
+        if (ARNETWORK_IOBuffer_IsWaitAck (inputBufferPtr))
+        {
+            inputBufferPtr->retryCount = inputBufferPtr->numberOfRetry;
+        }
+    }
+    else if (inputBufferPtr->flowControlWaitTimeCount > 0)
+    {
+        inputBufferPtr->flowControlWaitTimeCount = 0;
+
+        /** the data waiting an acknowledgment was refused: send it again now */
+        if (ARNETWORK_IOBuffer_IsWaitAck (inputBufferPtr))
+        {
+            inputBufferPtr->ackWaitTimeCount = 0;
+        }
+    }
+}
+
+int ARNETWORK_Sender_GetOverflowWaitTimeMs (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr)
+{
+    /** -- get the time to wait after an overflow of ARNetworkAL -- */
+
+    /** local declarations */
+    int waitTimeMs = ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS;
+
+    if ((inputBufferPtr->overflowPolicy == ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_KEEP) &&
+        (senderPtr->alDrainRate > 0))
+    {
+        /** time needed by ARNetworkAL to drain a full buffer */
+        waitTimeMs = (senderPtr->networkALManager->maxBufferSize + senderPtr->alDrainRate - 1) / senderPtr->alDrainRate;
+        if (waitTimeMs < ARNETWORK_SENDER_MIN_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS)
+        {
+            waitTimeMs = ARNETWORK_SENDER_MIN_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS;
+        }
+        else if (waitTimeMs > ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS)
+        {
+            waitTimeMs = ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS;
+        }
+    }
+
+    return waitTimeMs;
+}
+
+int64_t ARNETWORK_Sender_GetCoalescingRemainingTimeUs (ARNETWORK_Sender_t *senderPtr, const struct timespec *now)
+{
+    /** -- get the time remaining before the end of the send coalescing window -- */
+
+    /** local declarations */
+    int64_t remainingTimeUs = -1;
+
+    if ((senderPtr->sendCoalescingWindowUs > 0) && (senderPtr->alBytesPushed > 0))
+    {
+        remainingTimeUs = senderPtr->sendCoalescingWindowUs -
+            (((int64_t)(now->tv_sec - senderPtr->firstPushTime.tv_sec) * 1000000) + ((now->tv_nsec - senderPtr->firstPushTime.tv_nsec) / 1000));
+        if (remainingTimeUs < 0)
+        {
+            remainingTimeUs = 0;
+        }
+    }
+
+    return remainingTimeUs;
+}
+
+void ARNETWORK_Sender_PreciseWait (ARNETWORK_SenderLane_t *lanePtr, int64_t waitTimeUs)
+{
+    /** -- sleep until a sending date or the end of the send coalescing window less than a millisecond away, or until new data are signalled to the sender lane -- */
+
+    /** local declarations */
+    struct timespec startTime;
+    struct timespec now;
+    int64_t remainingTimeUs = waitTimeUs;
+
+    ARSAL_Time_GetTime(&startTime);
+    while ((remainingTimeUs > 0) &&
+           (lanePtr->senderPtr->isAlive) &&
+           (__atomic_load_n (&(lanePtr->hasNewData), __ATOMIC_ACQUIRE) == 0))
+    {
+        usleep ((useconds_t)((remainingTimeUs < ARNETWORK_SENDER_PRECISE_WAIT_SLICE_US) ? remainingTimeUs : ARNETWORK_SENDER_PRECISE_WAIT_SLICE_US));
+        ARSAL_Time_GetTime(&now);
+        remainingTimeUs = waitTimeUs - ARNETWORK_Sender_ComputeTimespecUsTimeDiff (&startTime, &now);
+    }
+}
+
+int64_t ARNETWORK_Sender_ComputeTimespecUsTimeDiff (const struct timespec *startTime, const struct timespec *endTime)
+{
+    /** -- compute the time between two dates in microsecond -- */
+
+    return ((int64_t)(endTime->tv_sec - startTime->tv_sec) * 1000000) + ((endTime->tv_nsec - startTime->tv_nsec) / 1000);
+}
+
 eARNETWORK_MANAGER_CALLBACK_RETURN ARNETWORK_Sender_TimeOutCallback (ARNETWORK_Sender_t *senderPtr, const ARNETWORK_IOBuffer_t *inputBufferPtr)
 {
     /** -- call the Callback this timeout status -- */
@@ -63,12 +63,67 @@
  */
 #define ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS (10)
 
+/**
+ * Minimum wait time after an overflow of a buffer keeping its data
+ * (ARNETWORK_IOBUFFERPARAM_OVERFLOWPOLICY_KEEP). The wait time is the time
+ * needed by ARNetworkAL to drain a full buffer, between this value and
+ * ARNETWORK_SENDER_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS
+ */
+#define ARNETWORK_SENDER_MIN_WAIT_TIME_ON_ARNETWORKAL_OVERFLOW_MS (1)
+
+/**
+ * Weight (1/N) of a new measure in the estimation of the ARNetworkAL drain rate
+ */
+#define ARNETWORK_SENDER_DRAIN_RATE_SMOOTHING (8)
+
+/**
+ * Maximum time between two sends of ARNetworkAL measured in the estimation of
+ * its drain rate: a longer interval includes a time without data to send
+ */
+#define ARNETWORK_SENDER_DRAIN_RATE_MAX_INTERVAL_MS (100)
+
+/**
+ * Duration of the slices of the sleep of a sender lane before a sending date or
+ * the end of the send coalescing window less than a millisecond away ; the lane checks for new data between two slices
+ */
+#define ARNETWORK_SENDER_PRECISE_WAIT_SLICE_US (50)
+
+/**
+ * Maximum number of frames of an input buffer given to ARNetworkAL in one batch
+ */
+#define ARNETWORK_SENDER_BATCH_SIZE_MAX (32)
+
+/**
+ * Maximum time a flow-controlled input buffer stops sending after the remote
+ * output buffer advertised it is full, when the input buffer has no ackTimeoutMs
+ */
+#define ARNETWORK_SENDER_FLOW_CONTROL_WAIT_TIME_MS (500)
+
+typedef struct ARNETWORK_Sender_t ARNETWORK_Sender_t;
+
+/**
+ * @brief sender lane, processing the input buffers assigned to it in its own thread
+ * @note The lane 0 also processes the internal input buffers and sends the pings
+ */
+typedef struct
+{
+    ARNETWORK_Sender_t *senderPtr; /**< Pointer on the Sender owning the lane */
+    int index; /**< Index of the lane in the Sender */
+
+    ARSAL_Mutex_t nextSendMutex; /**< Mutex for the nextSendCond condition */
+    ARSAL_Cond_t nextSendCond; /**< Condition to wait on to force synchronous send */
+
+    int hadARNetworkALOverflowOnPreviousRun; /**< 1 if the previous run of the lane was not able to send all the data due to an overflow of the ARNetworkAL Buffer */
+    int overflowWaitTimeMs; /**< Time to wait after the overflow of the previous run of the lane */
+    int hasNewData; /**< 1 if new data were signalled since the start of the run of the lane ; read and written atomically */
+}ARNETWORK_SenderLane_t;
+
 /**
  * @brief sending manager
  * @warning before to be used the sender must be created through ARNETWORK_Sender_New()
  * @post after its using the sender must be deleted through ARNETWORK_Sender_Delete()
  */
-typedef struct
+struct ARNETWORK_Sender_t
 {
     ARNETWORKAL_Manager_t *networkALManager;
 
@@ -78,10 +133,12 @@ typedef struct
     int numberOfInternalInputBuff;
     ARNETWORK_IOBuffer_t **inputBufferPtrMap; /**< address of the array storing the inputBuffers by their identifier */
 
-    ARSAL_Mutex_t nextSendMutex; /**< Mutex for the nextSendCond condition */
-    ARSAL_Cond_t nextSendCond; /**< Condition to wait on to force synchronous send */
+    ARNETWORK_SenderLane_t *laneArr; /**< array of the sender lanes */
+    int numberOfLanes; /**< number of sender lanes (1 + highest senderLane of the input buffers) */
 
-    int isAlive; /**< Indicator of aliving used for kill the thread calling the ARNETWORK_Sender_ThreadRun function (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Sender_Stop()*/
+    ARSAL_Mutex_t networkALMutex; /**< Mutex to take before to give frames to ARNetworkAL or to send them, and to use the ARNetworkAL related values */
+
+    int isAlive; /**< Indicator of aliving used for kill the threads calling the ARNETWORK_Sender_ThreadRun and ARNETWORK_Sender_LaneThreadRun functions (1 = alive | 0 = dead). Must be accessed through ARNETWORK_Sender_Stop()*/
 
     ARSAL_Mutex_t pingMutex; /**< Mutex to lock all ping-related values */
     struct timespec pingStartTime; /**< Start timestamp of the current running ping */
@@ -90,9 +147,17 @@ typedef struct
     int minTimeBetweenPings; /**< Minimum time to wait between pings. Negative value mean no ping */
 
     int minimumTimeBetweenSendsMs; /**< Minimum time to wait between network sends */
-    int hadARNetworkALOverflowOnPreviousRun; /**< 1 if the previous run was not able to send all the data due to an overflow of the ARNetworkAL Buffer */
+    uint32_t alBytesPushed; /**< Number of bytes given to ARNetworkAL since the last send */
+    int alDrainRate; /**< Estimated drain rate of ARNetworkAL in bytes per millisecond (0 = unknown) */
+    struct timespec lastSendTime; /**< Date of the last send of ARNetworkAL with at least one frame, start of the interval measured by the drain rate */
+
+    int sendCoalescingWindowUs; /**< Maximum time, in microsecond, to hold the frames given to ARNetworkAL before sending them (0 = send at each run) */
+    struct timespec firstPushTime; /**< Date of the first frame given to ARNetworkAL since the last send */
+    int hasPendingUrgentFrame; /**< 1 if a low latency or scheduled frame was given to ARNetworkAL since the last send */
+    uint32_t nbFramesPushed; /**< Number of frames given to ARNetworkAL since the creation of the sender */
+    uint32_t nbSends; /**< Number of sends of ARNetworkAL with at least one frame since the creation of the sender */
 
-}ARNETWORK_Sender_t;
+};
 
 /**
  * @brief Create a new sender
@@ -128,39 +193,79 @@ void ARNETWORK_Sender_Delete (ARNETWORK_Sender_t **senderPtrAddr);
  */
 void* ARNETWORK_Sender_ThreadRun (void* data);
 
+/**
+ * @brief Manage the sending of the data of the input buffers assigned to a sender lane
+ * @warning This function must be called by a specific thread.
+ * @post Before join the thread calling this function, ARNETWORK_Sender_Stop() must be called.
+ * @note ARNETWORK_Sender_ThreadRun() runs the lane 0.
+ * @param data thread datas of type ARNETWORK_SenderLane_t*
+ * @return NULL
+ * @see ARNETWORK_Sender_Stop()
+ */
+void* ARNETWORK_Sender_LaneThreadRun (void* data);
+
+/**
+ * @brief Gets a sender lane
+ * @param senderPtr the pointer on the Sender
+ * @param[in] laneIndex index of the lane
+ * @return Pointer on the lane, or NULL if no input buffer uses this lane
+ */
+ARNETWORK_SenderLane_t* ARNETWORK_Sender_GetLane (ARNETWORK_Sender_t *senderPtr, int laneIndex);
+
 /**
  * @brief Process a buffer in the send loop
- * This function is called internally by the ARNETWORK_Sender_ThreadRun() function.
+ * This function is called internally by the ARNETWORK_Sender_LaneThreadRun() function.
  * It should not be called anywhere else (not thread safe, not reentrant ...)
- * @param senderPtr the pointer on the Sender
+ * @param lanePtr the pointer on the sender lane of the buffer
  * @param buffer the buffer to process
  * @param hasWaited flag to indicate that a milisecond has passed since the last call for this buffer
  */
-void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *buffer, int hasWaited);
+void ARNETWORK_Sender_ProcessBufferToSend (ARNETWORK_SenderLane_t *lanePtr, ARNETWORK_IOBuffer_t *buffer, int hasWaited);
 
 /**
  * @brief Stop the sending
- * @details Used to kill the thread calling ARNETWORK_Sender_ThreadRun().
+ * @details Used to kill the threads calling ARNETWORK_Sender_ThreadRun() and ARNETWORK_Sender_LaneThreadRun().
  * @param senderPtr the pointer on the Sender
  * @see ARNETWORK_Sender_ThreadRun()
  */
 void ARNETWORK_Sender_Stop (ARNETWORK_Sender_t *senderPtr);
 
 /**
- * @brief Signals to the sender that new data are available in a low latency buffer
+ * @brief Signals to the sender lane of an input buffer that new data are available in this buffer
+ * @param senderPtr pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer
+ */
+void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr);
+
+/**
+ * @brief Try to send a data of an input buffer from the calling thread, without copying it in the input buffer
+ * @details The data is given to ARNetworkAL, only if ARNetworkAL is not used by a sending thread, and sent with the frames already given to ARNetworkAL.
+ * A data of a ARNETWORKAL_FRAME_TYPE_DATA input buffer is only given when the sending wait time of the input buffer is elapsed, and is held by the send coalescing window.
+ * The callback is called with the sent, free (data not copied only) and done status, as if the data was sent by the sending thread.
+ * @warning The IOBuffer mutex must lock before the calling of this function and unlock after.
+ * @warning The input buffer must be empty
  * @param senderPtr pointer on the Sender
+ * @param inputBufferPtr Pointer on the input buffer
+ * @param[in] data The data to send
+ * @param[in] dataSize size of the data to send
+ * @param[in] customData custom data sent to the callback
+ * @param[in] callback pointer on the callback
+ * @param[in] doDataCopy indicator of the copy of the data requested by the caller
+ * @return 1 if the data was sent, otherwise 0 and the data must be added in the input buffer
  */
-void ARNETWORK_Sender_SignalNewData (ARNETWORK_Sender_t *senderPtr);
+int ARNETWORK_Sender_TrySendInline (ARNETWORK_Sender_t *senderPtr, ARNETWORK_IOBuffer_t *inputBufferPtr, uint8_t *data, int dataSize, void *customData, ARNETWORK_Manager_Callback_t callback, int doDataCopy);
 
 /**
  * @brief Receive an acknowledgment fo a data.
  * @details Called by a libARNetwork/receiver to transmit an acknowledgment.
+ * The number of free cells advertised by a flow-controlled output buffer is used even if the acknowledgment does not match the data sent.
  * @param senderPtr the pointer on the Sender
  * @param[in] ID identifier of the command with ARNETWORKAL_FRAME_TYPE_ACK type received by the libARNetwork/receiver
  * @param[in] seqNumber sequence number of the acknowledgment
+ * @param[in] numberOfFreeCells number of free cells of the remote output buffer sent with the acknowledgment (-1 = not sent)
  * @return error equal to ARNETWORK_OK if the data has been correctly acknowledged otherwise equal to 1.
  */
-eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber);
+eARNETWORK_ERROR ARNETWORK_Sender_AckReceived (ARNETWORK_Sender_t *senderPtr, int identifier, uint8_t seqNumber, int numberOfFreeCells);
 
 /**
  * @brief flush all IoBuffers of the Sender
@@ -0,0 +1,260 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file sendCoalescingBench.c
+ * @brief libARNetwork TestBench measuring the network sends saved by the send coalescing window
+ * @date 10/18/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define BENCH_TAG "SendCoalescingBench"
+
+#define BENCH_PING_DELAY (-1) /**< ping disabled */
+
+#define BENCH_PORT1 12345
+#define BENCH_PORT2 54321
+#define BENCH_ADRR_IP "127.0.0.1"
+#define BENCH_RECV_TIMEOUT_SEC 5
+
+#define BENCH_NUMBER_OF_INPUT 4 /**< number of input buffers the data are spread over */
+#define BENCH_NUMBER_OF_SEND 8000 /**< number of data sent by one measure */
+#define BENCH_SEND_PERIOD_US 250 /**< time between two data, each one sent in the next input buffer */
+#define BENCH_DRAIN_TIME_MS 100 /**< time let to the sender to send the last data of a measure */
+#define BENCH_DATA_SIZE 16
+#define BENCH_NUMBER_OF_CELL 64
+
+/** send coalescing windows measured, in microseconds ; the first one disables the window */
+static const int BENCH_WINDOW_US[] = {0, 250, 500, 1000, 2000};
+
+/** define of the ioBuffer identifiers */
+typedef enum
+{
+    ID_IOBUFFER_FIRST = 10,
+
+    ID_IOBUFFER_MAX = ID_IOBUFFER_FIRST + BENCH_NUMBER_OF_INPUT
+} eID_IOBUFFER;
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+int BENCH_Measure(ARNETWORK_Manager_t *managerPtr, int windowUs);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(void)
+{
+    /** local declarations */
+    ARNETWORKAL_Manager_t *networkALManagerPtr = NULL;
+    ARNETWORK_Manager_t *managerPtr = NULL;
+    ARNETWORK_IOBufferParam_t paramInput[BENCH_NUMBER_OF_INPUT];
+    ARSAL_Thread_t sendingThread = NULL;
+    ARSAL_Thread_t receivingThread = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+    int windowIndex = 0;
+    int inputIndex = 0;
+    int ret = 0;
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, BENCH_TAG, " -- libARNetwork TestBench send coalescing --");
+
+    /** several data input buffers, each one sending its data in its own frame */
+    for (inputIndex = 0; inputIndex < BENCH_NUMBER_OF_INPUT; ++inputIndex)
+    {
+        ARNETWORK_IOBufferParam_DefaultInit (&(paramInput[inputIndex]));
+        paramInput[inputIndex].ID = ID_IOBUFFER_FIRST + inputIndex;
+        paramInput[inputIndex].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+        paramInput[inputIndex].sendingWaitTimeMs = 0;
+        paramInput[inputIndex].numberOfCell = BENCH_NUMBER_OF_CELL;
+        paramInput[inputIndex].dataCopyMaxSize = BENCH_DATA_SIZE;
+    }
+
+    networkALManagerPtr = ARNETWORKAL_Manager_New(&specificError);
+    if (specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManagerPtr, BENCH_ADRR_IP, BENCH_PORT1, BENCH_PORT2, BENCH_RECV_TIMEOUT_SEC);
+    }
+
+    if (specificError == ARNETWORKAL_OK)
+    {
+        managerPtr = ARNETWORK_Manager_New(networkALManagerPtr, BENCH_NUMBER_OF_INPUT, paramInput, 0, NULL, BENCH_PING_DELAY, NULL, NULL, &error);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Thread_Create(&sendingThread, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, managerPtr);
+        ARSAL_Thread_Create(&receivingThread, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, managerPtr);
+
+        printf("window us |    sends/s | frames/send\n");
+
+        for (windowIndex = 0; (windowIndex < (int)(sizeof(BENCH_WINDOW_US) / sizeof(BENCH_WINDOW_US[0]))) && (ret == 0); ++windowIndex)
+        {
+            ret = BENCH_Measure(managerPtr, BENCH_WINDOW_US[windowIndex]);
+        }
+
+        ARNETWORK_Manager_Stop(managerPtr);
+        ARSAL_Thread_Join(sendingThread, NULL);
+        ARSAL_Thread_Join(receivingThread, NULL);
+        ARSAL_Thread_Destroy(&sendingThread);
+        ARSAL_Thread_Destroy(&receivingThread);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "error creating the manager: %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    ARNETWORK_Manager_Delete(&managerPtr);
+    ARNETWORKAL_Manager_CloseWifiNetwork(networkALManagerPtr);
+    ARNETWORKAL_Manager_Delete(&networkALManagerPtr);
+
+    return (ret == 0) ? 0 : 1;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    (void) OutBufferId;
+    (void) dataPtr;
+    (void) customData;
+    (void) status;
+
+    /** the data are copied, nothing to free */
+    return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+int BENCH_Measure(ARNETWORK_Manager_t *managerPtr, int windowUs)
+{
+    /** -- send data at a fixed rate over the input buffers, and count the network sends and the frames they carried -- */
+
+    /** local declarations */
+    uint8_t sendData[BENCH_DATA_SIZE] = {0};
+    struct timespec startTime;
+    struct timespec endTime;
+    struct timespec now;
+    int64_t elapsedUs = 0;
+    int64_t nextSendUs = 0;
+    uint32_t startFramesCount = 0;
+    uint32_t startSendsCount = 0;
+    uint32_t endFramesCount = 0;
+    uint32_t endSendsCount = 0;
+    uint32_t framesCount = 0;
+    uint32_t sendsCount = 0;
+    int sendIndex = 0;
+    int ret = 0;
+
+    if ((ARNETWORK_Manager_SetSendCoalescingWindow(managerPtr, windowUs) != ARNETWORK_OK) ||
+        (ARNETWORK_Manager_GetSenderStats(managerPtr, &startFramesCount, &startSendsCount) != ARNETWORK_OK))
+    {
+        ret = -1;
+    }
+
+    ARSAL_Time_GetTime(&startTime);
+    for (sendIndex = 0; (sendIndex < BENCH_NUMBER_OF_SEND) && (ret == 0); ++sendIndex)
+    {
+        /** the data are paced on their dates, not on the time between two sends, so that the rate does not drift */
+        nextSendUs = (int64_t)sendIndex * BENCH_SEND_PERIOD_US;
+        ARSAL_Time_GetTime(&now);
+        elapsedUs = ((int64_t)(now.tv_sec - startTime.tv_sec) * 1000000) + ((now.tv_nsec - startTime.tv_nsec) / 1000);
+        if (elapsedUs < nextSendUs)
+        {
+            usleep((useconds_t)(nextSendUs - elapsedUs));
+        }
+
+        sendData[0] = (uint8_t) sendIndex;
+        if (ARNETWORK_Manager_SendData(managerPtr, ID_IOBUFFER_FIRST + (sendIndex % BENCH_NUMBER_OF_INPUT), sendData, BENCH_DATA_SIZE, NULL, &(BENCH_DataCallback), 1) != ARNETWORK_OK)
+        {
+            ret = -1;
+        }
+    }
+    ARSAL_Time_GetTime(&endTime);
+
+    /** let the sender send the data of the last window */
+    usleep(BENCH_DRAIN_TIME_MS * 1000);
+
+    if ((ret == 0) &&
+        (ARNETWORK_Manager_GetSenderStats(managerPtr, &endFramesCount, &endSendsCount) != ARNETWORK_OK))
+    {
+        ret = -1;
+    }
+
+    if (ret == 0)
+    {
+        elapsedUs = ((int64_t)(endTime.tv_sec - startTime.tv_sec) * 1000000) + ((endTime.tv_nsec - startTime.tv_nsec) / 1000);
+        if (elapsedUs <= 0)
+        {
+            elapsedUs = 1;
+        }
+        framesCount = endFramesCount - startFramesCount;
+        sendsCount = endSendsCount - startSendsCount;
+
+        printf("%9d | %10.0f | %11.2f\n",
+               windowUs,
+               (double) sendsCount * 1000000.0 / elapsedUs,
+               (sendsCount > 0) ? ((double) framesCount / sendsCount) : 0.0);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "error measuring the send coalescing window of %d us", windowUs);
+    }
+
+    return ret;
+}
@@ -0,0 +1,279 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file sendContentionBench.c
+ * @brief libARNetwork TestBench measuring the cost of ARNETWORK_Manager_SendData called by concurrent producers
+ * @date 10/18/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define BENCH_TAG "SendContentionBench"
+
+#define BENCH_PING_DELAY (-1) /**< ping disabled */
+
+#define BENCH_PORT1 12345
+#define BENCH_PORT2 54321
+#define BENCH_ADRR_IP "127.0.0.1"
+#define BENCH_RECV_TIMEOUT_SEC 5
+
+#define BENCH_NUMBER_OF_SEND 65536 /**< number of data sent by all the producers of one measure */
+#define BENCH_MAX_NUMBER_OF_PRODUCER 16
+#define BENCH_SEND_TIMEOUT_MS 1000
+#define BENCH_DATA_SIZE 16
+#define BENCH_NUMBER_OF_CELL BENCH_NUMBER_OF_SEND /**< the input buffers hold all the data of a measure */
+
+/** define of the ioBuffer identifiers */
+typedef enum
+{
+    ID_IOBUFFER_LOCKED = 10,
+    ID_IOBUFFER_LOCK_FREE,
+
+    ID_IOBUFFER_MAX
+} eID_IOBUFFER;
+
+typedef struct
+{
+    ARNETWORK_Manager_t *managerPtr;
+    int inputBufferID;
+    int numberOfSend;
+    int numberOfError;
+} BENCH_Producer_t;
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+void* BENCH_ProducerRun(void *data);
+int BENCH_Measure(ARNETWORK_Manager_t *managerPtr, int inputBufferID, int numberOfProducer, int *numberOfLostPtr);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(void)
+{
+    /** local declarations */
+    ARNETWORKAL_Manager_t *networkALManagerPtr = NULL;
+    ARNETWORK_Manager_t *managerPtr = NULL;
+    ARNETWORK_IOBufferParam_t paramInput[2];
+    ARSAL_Thread_t receivingThread = NULL;
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+    int numberOfProducer = 0;
+    int inputIndex = 0;
+    int numberOfLost = 0;
+    int totalNumberOfLost = 0;
+    int ret = 0;
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, BENCH_TAG, " -- libARNetwork TestBench send contention --");
+
+    /** the same input buffer with and without lock-free adding */
+    for (inputIndex = 0; inputIndex < 2; ++inputIndex)
+    {
+        ARNETWORK_IOBufferParam_DefaultInit (&(paramInput[inputIndex]));
+        paramInput[inputIndex].ID = ID_IOBUFFER_LOCKED + inputIndex;
+        paramInput[inputIndex].dataType = ARNETWORKAL_FRAME_TYPE_DATA;
+        paramInput[inputIndex].sendingWaitTimeMs = 1;
+        paramInput[inputIndex].numberOfCell = BENCH_NUMBER_OF_CELL;
+        paramInput[inputIndex].dataCopyMaxSize = BENCH_DATA_SIZE;
+        paramInput[inputIndex].isLockFree = inputIndex;
+    }
+
+    networkALManagerPtr = ARNETWORKAL_Manager_New(&specificError);
+    if (specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(networkALManagerPtr, BENCH_ADRR_IP, BENCH_PORT1, BENCH_PORT2, BENCH_RECV_TIMEOUT_SEC);
+    }
+
+    if (specificError == ARNETWORKAL_OK)
+    {
+        managerPtr = ARNETWORK_Manager_New(networkALManagerPtr, 2, paramInput, 0, NULL, BENCH_PING_DELAY, NULL, NULL, &error);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        /**
+         * the sending thread is not started: the measure is the cost of adding the data, not the rate at which the sender empties the buffer.
+         * the data of a measure are removed by flushing the buffer after it.
+         */
+        ARSAL_Thread_Create(&receivingThread, (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, managerPtr);
+
+        printf("producers |   locked ns/send |   locked send/s | locked lost | lock-free ns/send | lock-free send/s | lock-free lost\n");
+
+        for (numberOfProducer = 1; (numberOfProducer <= BENCH_MAX_NUMBER_OF_PRODUCER) && (ret == 0); numberOfProducer *= 2)
+        {
+            printf("%9d |", numberOfProducer);
+            ret = BENCH_Measure(managerPtr, ID_IOBUFFER_LOCKED, numberOfProducer, &numberOfLost);
+            totalNumberOfLost += numberOfLost;
+            if (ret == 0)
+            {
+                ret = BENCH_Measure(managerPtr, ID_IOBUFFER_LOCK_FREE, numberOfProducer, &numberOfLost);
+                totalNumberOfLost += numberOfLost;
+            }
+            printf("\n");
+        }
+
+        /** the data not accepted by the input buffers are lost: the measure of their mode is not comparable */
+        if (totalNumberOfLost > 0)
+        {
+            printf("%d data lost\n", totalNumberOfLost);
+            ret = -1;
+        }
+
+        ARNETWORK_Manager_Stop(managerPtr);
+        ARSAL_Thread_Join(receivingThread, NULL);
+        ARSAL_Thread_Destroy(&receivingThread);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "error creating the manager: %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    ARNETWORK_Manager_Delete(&managerPtr);
+    ARNETWORKAL_Manager_CloseWifiNetwork(networkALManagerPtr);
+    ARNETWORKAL_Manager_Delete(&networkALManagerPtr);
+
+    return (ret == 0) ? 0 : 1;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    (void) OutBufferId;
+    (void) dataPtr;
+    (void) customData;
+    (void) status;
+
+    /** the data are copied, nothing to free */
+    return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+void* BENCH_ProducerRun(void *data)
+{
+    /** -- send data as fast as the input buffer accepts them -- */
+
+    /** local declarations */
+    BENCH_Producer_t *producerPtr = data;
+    uint8_t sendData[BENCH_DATA_SIZE] = {0};
+    int sendIndex = 0;
+
+    for (sendIndex = 0; sendIndex < producerPtr->numberOfSend; ++sendIndex)
+    {
+        sendData[0] = (uint8_t) sendIndex;
+        if (ARNETWORK_Manager_SendDataWithTimeout(producerPtr->managerPtr, producerPtr->inputBufferID, sendData, BENCH_DATA_SIZE, NULL, &(BENCH_DataCallback), 1, BENCH_SEND_TIMEOUT_MS) != ARNETWORK_OK)
+        {
+            producerPtr->numberOfError++;
+        }
+    }
+
+    return NULL;
+}
+
+int BENCH_Measure(ARNETWORK_Manager_t *managerPtr, int inputBufferID, int numberOfProducer, int *numberOfLostPtr)
+{
+    /** -- measure the sending rate of numberOfProducer concurrent producers, and count the data they could not add -- */
+
+    /** local declarations */
+    BENCH_Producer_t producers[BENCH_MAX_NUMBER_OF_PRODUCER];
+    ARSAL_Thread_t producerThreads[BENCH_MAX_NUMBER_OF_PRODUCER];
+    struct timespec startTime;
+    struct timespec endTime;
+    int64_t elapsedNs = 0;
+    int numberOfError = 0;
+    int producerIndex = 0;
+
+    for (producerIndex = 0; producerIndex < numberOfProducer; ++producerIndex)
+    {
+        producers[producerIndex].managerPtr = managerPtr;
+        producers[producerIndex].inputBufferID = inputBufferID;
+        producers[producerIndex].numberOfSend = BENCH_NUMBER_OF_SEND / numberOfProducer;
+        producers[producerIndex].numberOfError = 0;
+    }
+
+    ARSAL_Time_GetTime(&startTime);
+    for (producerIndex = 0; producerIndex < numberOfProducer; ++producerIndex)
+    {
+        ARSAL_Thread_Create(&(producerThreads[producerIndex]), (ARSAL_Thread_Routine_t) BENCH_ProducerRun, &(producers[producerIndex]));
+    }
+    for (producerIndex = 0; producerIndex < numberOfProducer; ++producerIndex)
+    {
+        ARSAL_Thread_Join(producerThreads[producerIndex], NULL);
+        ARSAL_Thread_Destroy(&(producerThreads[producerIndex]));
+        numberOfError += producers[producerIndex].numberOfError;
+    }
+    ARSAL_Time_GetTime(&endTime);
+
+    elapsedNs = ((int64_t)(endTime.tv_sec - startTime.tv_sec) * 1000000000) + (endTime.tv_nsec - startTime.tv_nsec);
+    if (elapsedNs <= 0)
+    {
+        elapsedNs = 1;
+    }
+
+    /** the time per send is the time of one producer: the producers send in parallel */
+    printf(" %16.1f | %15.0f | %11d |",
+           (double) elapsedNs * numberOfProducer / BENCH_NUMBER_OF_SEND,
+           (double) BENCH_NUMBER_OF_SEND * 1000000000.0 / elapsedNs,
+           numberOfError);
+
+    ARNETWORK_Manager_FlushInputBuffer(managerPtr, inputBufferID);
+
+    *numberOfLostPtr = numberOfError;
+
+    return 0;
+}
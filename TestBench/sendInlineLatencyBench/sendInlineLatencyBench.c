@@ -0,0 +1,315 @@
+/*
+    Copyright (C) 2014 Parrot SA
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+    * Neither the name of Parrot nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+    COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+    OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+    AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+    OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+/**
+ * @file sendInlineLatencyBench.c
+ * @brief libARNetwork TestBench measuring the latency of low latency data sent by the sending thread or inline
+ * @date 10/18/2026
+ */
+
+/*****************************************
+ *
+ *             include file :
+ *
+ *****************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <libARSAL/ARSAL_Print.h>
+#include <libARSAL/ARSAL_Thread.h>
+#include <libARSAL/ARSAL_Time.h>
+
+#include <libARNetworkAL/ARNETWORKAL_Manager.h>
+#include <libARNetworkAL/ARNETWORKAL_Frame.h>
+
+#include <libARNetwork/ARNETWORK_Manager.h>
+#include <libARNetwork/ARNETWORK_IOBufferParam.h>
+
+/*****************************************
+ *
+ *             define :
+ *
+ *****************************************/
+
+#define BENCH_TAG "SendInlineLatencyBench"
+
+#define BENCH_PING_DELAY (-1) /**< ping disabled */
+
+#define BENCH_PORT1 12345
+#define BENCH_PORT2 54321
+#define BENCH_ADRR_IP "127.0.0.1"
+#define BENCH_RECV_TIMEOUT_SEC 5
+
+#define BENCH_NUMBER_OF_SEND 5000 /**< number of data sent by one measure */
+#define BENCH_SEND_PERIOD_US 1000 /**< time between two data: the sending thread is idle when a data is sent */
+#define BENCH_READ_TIMEOUT_MS 1000
+#define BENCH_LATENCY_TARGET_US 100 /**< latency target of the low latency data */
+#define BENCH_DATA_SIZE 16
+#define BENCH_NUMBER_OF_CELL 16
+
+/** define of the ioBuffer identifiers */
+typedef enum
+{
+    ID_IOBUFFER_QUEUED = 10,
+    ID_IOBUFFER_INLINE,
+
+    ID_IOBUFFER_MAX
+} eID_IOBUFFER;
+
+/** manager of one side of the loopback, with its threads */
+typedef struct
+{
+    ARNETWORKAL_Manager_t *networkALManagerPtr;
+    ARNETWORK_Manager_t *managerPtr;
+    ARSAL_Thread_t sendingThread;
+    ARSAL_Thread_t receivingThread;
+} BENCH_Peer_t;
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status);
+eARNETWORK_ERROR BENCH_PeerStart(BENCH_Peer_t *peerPtr, int sendingPort, int receivingPort, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr);
+void BENCH_PeerStop(BENCH_Peer_t *peerPtr);
+int BENCH_Measure(ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, int bufferID);
+
+/*****************************************
+ *
+ *          implementation :
+ *
+ *****************************************/
+
+int main(void)
+{
+    /** local declarations */
+    BENCH_Peer_t senderPeer;
+    BENCH_Peer_t readerPeer;
+    ARNETWORK_IOBufferParam_t paramInput[2];
+    ARNETWORK_IOBufferParam_t paramOutput[2];
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    int bufferIndex = 0;
+    int ret = 0;
+
+    ARSAL_PRINT (ARSAL_PRINT_WARNING, BENCH_TAG, " -- libARNetwork TestBench send inline latency --");
+
+    memset (&senderPeer, 0, sizeof(senderPeer));
+    memset (&readerPeer, 0, sizeof(readerPeer));
+
+    /** the same low latency input buffer sending from the sending thread and inline */
+    for (bufferIndex = 0; bufferIndex < 2; ++bufferIndex)
+    {
+        ARNETWORK_IOBufferParam_DefaultInit (&(paramInput[bufferIndex]));
+        paramInput[bufferIndex].ID = ID_IOBUFFER_QUEUED + bufferIndex;
+        paramInput[bufferIndex].dataType = ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY;
+        paramInput[bufferIndex].sendingWaitTimeMs = 0;
+        paramInput[bufferIndex].numberOfCell = BENCH_NUMBER_OF_CELL;
+        paramInput[bufferIndex].dataCopyMaxSize = BENCH_DATA_SIZE;
+        paramInput[bufferIndex].isSendingInline = bufferIndex;
+
+        ARNETWORK_IOBufferParam_DefaultInit (&(paramOutput[bufferIndex]));
+        paramOutput[bufferIndex].ID = ID_IOBUFFER_QUEUED + bufferIndex;
+        paramOutput[bufferIndex].dataType = ARNETWORKAL_FRAME_TYPE_DATA_LOW_LATENCY;
+        paramOutput[bufferIndex].numberOfCell = BENCH_NUMBER_OF_CELL;
+        paramOutput[bufferIndex].dataCopyMaxSize = BENCH_DATA_SIZE;
+    }
+
+    /** the two peers of the loopback send to the receiving port of each other */
+    error = BENCH_PeerStart(&senderPeer, BENCH_PORT1, BENCH_PORT2, 2, paramInput, 0, NULL);
+    if (error == ARNETWORK_OK)
+    {
+        error = BENCH_PeerStart(&readerPeer, BENCH_PORT2, BENCH_PORT1, 0, NULL, 2, paramOutput);
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        printf("   mode | avg latency us | max latency us | under %d us\n", BENCH_LATENCY_TARGET_US);
+
+        printf(" queued |");
+        ret = BENCH_Measure(senderPeer.managerPtr, readerPeer.managerPtr, ID_IOBUFFER_QUEUED);
+        if (ret == 0)
+        {
+            printf(" inline |");
+            ret = BENCH_Measure(senderPeer.managerPtr, readerPeer.managerPtr, ID_IOBUFFER_INLINE);
+        }
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "error creating the managers: %s", ARNETWORK_Error_ToString (error));
+        ret = -1;
+    }
+
+    BENCH_PeerStop(&senderPeer);
+    BENCH_PeerStop(&readerPeer);
+
+    return (ret == 0) ? 0 : 1;
+}
+
+eARNETWORK_MANAGER_CALLBACK_RETURN BENCH_DataCallback(int OutBufferId, uint8_t *dataPtr, void *customData, eARNETWORK_MANAGER_CALLBACK_STATUS status)
+{
+    (void) OutBufferId;
+    (void) dataPtr;
+    (void) customData;
+    (void) status;
+
+    /** the data are copied, nothing to free */
+    return ARNETWORK_MANAGER_CALLBACK_RETURN_DEFAULT;
+}
+
+eARNETWORK_ERROR BENCH_PeerStart(BENCH_Peer_t *peerPtr, int sendingPort, int receivingPort, unsigned int numberOfInput, ARNETWORK_IOBufferParam_t *inputParamArr, unsigned int numberOfOutput, ARNETWORK_IOBufferParam_t *outputParamArr)
+{
+    /** -- create the managers of one side of the loopback and start its threads -- */
+
+    /** local declarations */
+    eARNETWORK_ERROR error = ARNETWORK_OK;
+    eARNETWORKAL_ERROR specificError = ARNETWORKAL_OK;
+
+    peerPtr->networkALManagerPtr = ARNETWORKAL_Manager_New(&specificError);
+    if (specificError == ARNETWORKAL_OK)
+    {
+        specificError = ARNETWORKAL_Manager_InitWifiNetwork(peerPtr->networkALManagerPtr, BENCH_ADRR_IP, sendingPort, receivingPort, BENCH_RECV_TIMEOUT_SEC);
+    }
+
+    if (specificError == ARNETWORKAL_OK)
+    {
+        peerPtr->managerPtr = ARNETWORK_Manager_New(peerPtr->networkALManagerPtr, numberOfInput, inputParamArr, numberOfOutput, outputParamArr, BENCH_PING_DELAY, NULL, NULL, &error);
+    }
+    else
+    {
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "Can't init Wifi Network = %d", specificError);
+        error = ARNETWORK_ERROR;
+    }
+
+    if (error == ARNETWORK_OK)
+    {
+        ARSAL_Thread_Create(&(peerPtr->sendingThread), (ARSAL_Thread_Routine_t) ARNETWORK_Manager_SendingThreadRun, peerPtr->managerPtr);
+        ARSAL_Thread_Create(&(peerPtr->receivingThread), (ARSAL_Thread_Routine_t) ARNETWORK_Manager_ReceivingThreadRun, peerPtr->managerPtr);
+    }
+
+    return error;
+}
+
+void BENCH_PeerStop(BENCH_Peer_t *peerPtr)
+{
+    /** -- stop the threads of one side of the loopback and delete its managers -- */
+
+    if (peerPtr->managerPtr != NULL)
+    {
+        ARNETWORK_Manager_Stop(peerPtr->managerPtr);
+    }
+    if (peerPtr->sendingThread != NULL)
+    {
+        ARSAL_Thread_Join(peerPtr->sendingThread, NULL);
+        ARSAL_Thread_Destroy(&(peerPtr->sendingThread));
+    }
+    if (peerPtr->receivingThread != NULL)
+    {
+        ARSAL_Thread_Join(peerPtr->receivingThread, NULL);
+        ARSAL_Thread_Destroy(&(peerPtr->receivingThread));
+    }
+
+    ARNETWORK_Manager_Delete(&(peerPtr->managerPtr));
+    if (peerPtr->networkALManagerPtr != NULL)
+    {
+        ARNETWORKAL_Manager_CloseWifiNetwork(peerPtr->networkALManagerPtr);
+        ARNETWORKAL_Manager_Delete(&(peerPtr->networkALManagerPtr));
+    }
+}
+
+int BENCH_Measure(ARNETWORK_Manager_t *senderManagerPtr, ARNETWORK_Manager_t *readerManagerPtr, int bufferID)
+{
+    /** -- measure the time between the sending of each data and its reading by the remote manager -- */
+
+    /** local declarations */
+    uint8_t sendData[BENCH_DATA_SIZE] = {0};
+    uint8_t readData[BENCH_DATA_SIZE] = {0};
+    struct timespec sendTime;
+    struct timespec readTime;
+    int64_t latencyUs = 0;
+    int64_t sumLatencyUs = 0;
+    int64_t maxLatencyUs = 0;
+    int numberOfUnderTarget = 0;
+    int readSize = 0;
+    int sendIndex = 0;
+    int ret = 0;
+
+    for (sendIndex = 0; (sendIndex < BENCH_NUMBER_OF_SEND) && (ret == 0); ++sendIndex)
+    {
+        usleep(BENCH_SEND_PERIOD_US);
+
+        /** the date of the sending is carried by the data: a late data of a previous measure can not be mistaken for the current one */
+        ARSAL_Time_GetTime(&sendTime);
+        memcpy(sendData, &sendTime, (sizeof(sendTime) < BENCH_DATA_SIZE) ? sizeof(sendTime) : BENCH_DATA_SIZE);
+        if (ARNETWORK_Manager_SendData(senderManagerPtr, bufferID, sendData, BENCH_DATA_SIZE, NULL, &(BENCH_DataCallback), 1) != ARNETWORK_OK)
+        {
+            ret = -1;
+        }
+
+        if ((ret == 0) &&
+            (ARNETWORK_Manager_ReadDataWithTimeout(readerManagerPtr, bufferID, readData, BENCH_DATA_SIZE, &readSize, BENCH_READ_TIMEOUT_MS) != ARNETWORK_OK))
+        {
+            ret = -1;
+        }
+        ARSAL_Time_GetTime(&readTime);
+
+        if ((ret == 0) && (memcmp(readData, sendData, BENCH_DATA_SIZE) == 0))
+        {
+            latencyUs = ((int64_t)(readTime.tv_sec - sendTime.tv_sec) * 1000000) + ((readTime.tv_nsec - sendTime.tv_nsec) / 1000);
+            sumLatencyUs += latencyUs;
+            if (latencyUs > maxLatencyUs)
+            {
+                maxLatencyUs = latencyUs;
+            }
+            if (latencyUs < BENCH_LATENCY_TARGET_US)
+            {
+                numberOfUnderTarget++;
+            }
+        }
+        else if (ret == 0)
+        {
+            /** a data lost or read out of order: the measure is not reliable */
+            ret = -1;
+        }
+    }
+
+    if (ret == 0)
+    {
+        printf(" %14.1f | %14lld | %9.1f %%\n",
+               (double) sumLatencyUs / BENCH_NUMBER_OF_SEND,
+               (long long) maxLatencyUs,
+               (double) numberOfUnderTarget * 100.0 / BENCH_NUMBER_OF_SEND);
+    }
+    else
+    {
+        printf(" data lost\n");
+        ARSAL_PRINT (ARSAL_PRINT_ERROR, BENCH_TAG, "error measuring the latency of the buffer %d", bufferID);
+    }
+
+    return ret;
+}
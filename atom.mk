@@ -21,9 +21,12 @@ LOCAL_CFLAGS := \
 	-DHAVE_CONFIG_H
 
 LOCAL_SRC_FILES := \
+	Sources/ARNETWORK_BroadcastRing.c \
+	Sources/ARNETWORK_Buffer.c \
 	Sources/ARNETWORK_IOBuffer.c \
 	Sources/ARNETWORK_IOBufferParam.c \
 	Sources/ARNETWORK_Manager.c \
+	Sources/ARNETWORK_LockFreeQueue.c \
 	Sources/ARNETWORK_Receiver.c \
 	Sources/ARNETWORK_RingBuffer.c \
 	Sources/ARNETWORK_Sender.c \
@@ -31,6 +34,7 @@ LOCAL_SRC_FILES := \
 
 LOCAL_INSTALL_HEADERS := \
 	Includes/libARNetwork/ARNetwork.h:usr/include/libARNetwork/ \
+	Includes/libARNetwork/ARNETWORK_Buffer.h:usr/include/libARNetwork/ \
 	Includes/libARNetwork/ARNETWORK_Error.h:usr/include/libARNetwork/ \
 	Includes/libARNetwork/ARNETWORK_IOBufferParam.h:usr/include/libARNetwork/ \
 	Includes/libARNetwork/ARNETWORK_Manager.h:usr/include/libARNetwork/
@@ -63,6 +63,8 @@ public enum ARNETWORK_ERROR_ENUM {
     ARNETWORK_ERROR_MUTEX (-993, "Error when using a mutex"),
    /** A mutex is already locked by the same thread */
     ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK (-992, "A mutex is already locked by the same thread"),
+   /** Buffer is full and its oldest data can not be overwritten */
+    ARNETWORK_ERROR_BUFFER_FULL (-991, "Buffer is full and its oldest data can not be overwritten"),
    /** Unknown ARNETWORK_Manager error */
     ARNETWORK_ERROR_MANAGER (-2000, "Unknown ARNETWORK_Manager error"),
    /** IOBuffer creation error */
@@ -79,6 +81,10 @@ public enum ARNETWORK_ERROR_ENUM {
     ARNETWORK_ERROR_IOBUFFER (-3000, "Unknown IOBuffer error"),
    /** Bad sequence number for the acknowledge */
     ARNETWORK_ERROR_IOBUFFER_BAD_ACK (-2999, "Bad sequence number for the acknowledge"),
+   /** The data is not in the IOBuffer anymore */
+    ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND (-2998, "The data is not in the IOBuffer anymore"),
+   /** A data of the IOBuffer is borrowed and not released yet */
+    ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED (-2997, "A data of the IOBuffer is borrowed and not released yet"),
    /** Unknown Receiver error */
     ARNETWORK_ERROR_RECEIVER (-5000, "Unknown Receiver error"),
    /** Receiver buffer too small */
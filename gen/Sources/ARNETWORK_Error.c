@@ -74,6 +74,9 @@ const char* ARNETWORK_Error_ToString (eARNETWORK_ERROR error)
     case ARNETWORK_ERROR_MUTEX_DOUBLE_LOCK:
         return "A mutex is already locked by the same thread";
         break;
+    case ARNETWORK_ERROR_BUFFER_FULL:
+        return "Buffer is full and its oldest data can not be overwritten";
+        break;
     case ARNETWORK_ERROR_MANAGER:
         return "Unknown ARNETWORK_Manager error";
         break;
@@ -98,6 +101,12 @@ const char* ARNETWORK_Error_ToString (eARNETWORK_ERROR error)
     case ARNETWORK_ERROR_IOBUFFER_BAD_ACK:
         return "Bad sequence number for the acknowledge";
         break;
+    case ARNETWORK_ERROR_IOBUFFER_DATA_NOT_FOUND:
+        return "The data is not in the IOBuffer anymore";
+        break;
+    case ARNETWORK_ERROR_IOBUFFER_DATA_BORROWED:
+        return "A data of the IOBuffer is borrowed and not released yet";
+        break;
     case ARNETWORK_ERROR_RECEIVER:
         return "Unknown Receiver error";
         break;